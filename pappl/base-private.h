@@ -93,6 +93,22 @@ typedef ipp_copycb_t ipp_copy_cb_t;
 #    define _PAPPL_DEBUG(...)
 #  endif // DEBUG
 
+#  if _WIN32
+#    define _PAPPL_ATOMIC_ADD(p,v) InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(v))
+#    define _PAPPL_ATOMIC_GET(p) InterlockedCompareExchange((volatile LONG *)(p), 0, 0)
+#    define _PAPPL_ATOMIC_SET(p,v) InterlockedExchange((volatile LONG *)(p), (LONG)(v))
+#    define _PAPPL_ATOMIC_ADD64(p,v) InterlockedExchangeAdd64((volatile LONG64 *)(p), (LONG64)(v))
+#    define _PAPPL_ATOMIC_GET64(p) InterlockedCompareExchange64((volatile LONG64 *)(p), 0, 0)
+#    define _PAPPL_ATOMIC_SET64(p,v) InterlockedExchange64((volatile LONG64 *)(p), (LONG64)(v))
+#  else
+#    define _PAPPL_ATOMIC_ADD(p,v) __atomic_fetch_add(p, v, __ATOMIC_RELAXED)
+#    define _PAPPL_ATOMIC_GET(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#    define _PAPPL_ATOMIC_SET(p,v) __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#    define _PAPPL_ATOMIC_ADD64(p,v) __atomic_fetch_add(p, (long long)(v), __ATOMIC_RELAXED)
+#    define _PAPPL_ATOMIC_GET64(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#    define _PAPPL_ATOMIC_SET64(p,v) __atomic_store_n(p, (long long)(v), __ATOMIC_RELAXED)
+#  endif // _WIN32
+
 #  define _PAPPL_LOC(s) s
 #  define _PAPPL_LOOKUP_STRING(bit,strings) _papplLookupString(bit, sizeof(strings) / sizeof(strings[0]), strings)
 #  define _PAPPL_LOOKUP_VALUE(keyword,strings) _papplLookupValue(keyword, sizeof(strings) / sizeof(strings[0]), strings)
@@ -14,6 +14,71 @@
 
 #include "pappl-private.h"
 
+//
+// Local functions...
+//
+
+static bool	add_index(pappl_client_t *client, ipp_attribute_t *attr);
+static int	compare_index(_pappl_attr_index_t *a, _pappl_attr_index_t *b);
+
+
+//
+// '_papplClientFindAttribute()' - Find an attribute in the current request.
+//
+// This function finds the first attribute in the client's IPP request with the
+// given name and value tag.  Like `ippFindAttribute`, names are compared
+// without regard to case, and `IPP_TAG_TEXT` and `IPP_TAG_NAME` also match
+// text and name values with a language.
+//
+// Once the request has been indexed, each lookup is a binary search of a
+// sorted index instead of a scan of the whole request.  Member attribute
+// names ("name/member") and unindexed requests use `ippFindAttribute`.
+//
+
+ipp_attribute_t *			// O - Attribute or `NULL` if not found
+_papplClientFindAttribute(
+    pappl_client_t *client,		// I - Client
+    const char     *name,		// I - Attribute name
+    ipp_tag_t      value_tag)		// I - Value tag or `IPP_TAG_ZERO` for any
+{
+  size_t		left,		// Left side of search
+			right,		// Right side of search
+			current;	// Current entry
+  _pappl_attr_index_t	*entry;		// Current index entry
+  ipp_tag_t		tag;		// Value tag of attribute
+
+
+  if (!client->request || !name)
+    return (NULL);
+
+  // Use the slow path for member attributes or when the request has not been
+  // indexed...
+  if (!client->num_attr_index || strchr(name, '/'))
+    return (ippFindAttribute(client->request, name, value_tag));
+
+  // Find the first entry with this name...
+  for (left = 0, right = client->num_attr_index; left < right;)
+  {
+    current = (left + right) / 2;
+
+    if (strcasecmp(client->attr_index[current].name, name) < 0)
+      left = current + 1;
+    else
+      right = current;
+  }
+
+  // Then return the first one with a matching value tag...
+  for (entry = client->attr_index + left; left < client->num_attr_index && !strcasecmp(entry->name, name); left ++, entry ++)
+  {
+    tag = ippGetValueTag(entry->attr);
+
+    if (value_tag == IPP_TAG_ZERO || tag == value_tag || (tag == IPP_TAG_TEXTLANG && value_tag == IPP_TAG_TEXT) || (tag == IPP_TAG_NAMELANG && value_tag == IPP_TAG_NAME))
+      return (entry->attr);
+  }
+
+  return (NULL);
+}
+
 
 //
 // '_papplClientFlushDocumentData()' - Safely flush remaining document data.
@@ -52,6 +117,35 @@ _papplClientHaveDocumentData(
 }
 
 
+//
+// '_papplClientIndexAttribute()' - Add an attribute to the request index.
+//
+// This function must be called for any attribute added to the request after
+// it has been indexed.
+//
+
+void
+_papplClientIndexAttribute(
+    pappl_client_t  *client,		// I - Client
+    ipp_attribute_t *attr)		// I - Attribute
+{
+  _pappl_attr_index_t	*entry,		// New entry
+			temp;		// Temporary entry
+
+
+  if (!attr || !client->num_attr_index || !add_index(client, attr))
+    return;
+
+  // Move the new entry into place...
+  for (entry = client->attr_index + client->num_attr_index - 1; entry > client->attr_index && compare_index(entry - 1, entry) > 0; entry --)
+  {
+    temp      = entry[-1];
+    entry[-1] = entry[0];
+    entry[0]  = temp;
+  }
+}
+
+
 //
 // '_papplClientProcessIPP()' - Process an IPP request.
 //
@@ -68,8 +162,9 @@ _papplClientProcessIPP(
   int			major, minor;	// Version number
   ipp_op_t		op;		// Operation code
   const char		*name;		// Name of attribute
-  bool			printer_op = true;
+  bool			printer_op = true,
 					// Printer operation?
+			indexed = true;	// Was the request indexed?
 
 
   // First build an empty response message for this request...
@@ -98,7 +193,9 @@ _papplClientProcessIPP(
   else
   {
     // Make sure that the attributes are provided in the correct order and
-    // don't repeat groups...
+    // don't repeat groups, indexing them as we go...
+    client->num_attr_index = 0;
+
     for (attr = ippGetFirstAttribute(client->request), group = ippGetGroupTag(attr); attr; attr = ippGetNextAttribute(client->request))
     {
       if (ippGetGroupTag(attr) < group && ippGetGroupTag(attr) != IPP_TAG_ZERO)
@@ -109,8 +206,16 @@ _papplClientProcessIPP(
       }
       else
 	group = ippGetGroupTag(attr);
+
+      if (indexed && !add_index(client, attr))
+        indexed = false;
     }
 
+    if (attr || !indexed)
+      client->num_attr_index = 0;	// Don't use a partial index
+    else if (client->num_attr_index > 1)
+      qsort(client->attr_index, client->num_attr_index, sizeof(_pappl_attr_index_t), (int (*)(const void *, const void *))compare_index);
+
     if (!attr)
     {
       // Then make sure that the first three attributes are:
@@ -133,11 +238,11 @@ _papplClientProcessIPP(
       else
 	language = NULL;
 
-      if ((attr = ippFindAttribute(client->request, "system-uri", IPP_TAG_URI)) != NULL)
+      if ((attr = _papplClientFindAttribute(client, "system-uri", IPP_TAG_URI)) != NULL)
 	uri = attr;
-      else if ((attr = ippFindAttribute(client->request, "printer-uri", IPP_TAG_URI)) != NULL)
+      else if ((attr = _papplClientFindAttribute(client, "printer-uri", IPP_TAG_URI)) != NULL)
 	uri = attr;
-      else if ((attr = ippFindAttribute(client->request, "job-uri", IPP_TAG_URI)) != NULL)
+      else if ((attr = _papplClientFindAttribute(client, "job-uri", IPP_TAG_URI)) != NULL)
 	uri = attr;
       else
 	uri = NULL;
@@ -184,7 +289,7 @@ _papplClientProcessIPP(
 	      papplClientRespondIPP(client, IPP_STATUS_ERROR_ATTRIBUTES_OR_VALUES, "Bad %s value '%s'.", name, ippGetString(uri, 0, NULL));
 	    }
 	    else
-	      client->printer = papplSystemFindPrinter(client->system, NULL, ippGetInteger(ippFindAttribute(client->request, "printer-id", IPP_TAG_INTEGER), 0), NULL);
+	      client->printer = papplSystemFindPrinter(client->system, NULL, ippGetInteger(_papplClientFindAttribute(client, "printer-id", IPP_TAG_INTEGER), 0), NULL);
 	  }
 	  else if ((client->printer = papplSystemFindPrinter(client->system, resource, 0, NULL)) != NULL)
 	  {
@@ -198,7 +303,7 @@ _papplClientProcessIPP(
 	        job_id = 0;
 	    }
 	    else
-	      job_id = ippGetInteger(ippFindAttribute(client->request, "job-id", IPP_TAG_INTEGER), 0);
+	      job_id = ippGetInteger(_papplClientFindAttribute(client, "job-id", IPP_TAG_INTEGER), 0);
 
 	    if (job_id)
 	    {
@@ -318,3 +423,70 @@ papplClientRespondIPPUnsupported(
   temp = ippCopyAttribute(client->response, attr, 0);
   ippSetGroupTag(client->response, &temp, IPP_TAG_UNSUPPORTED_GROUP);
 }
+
+
+//
+// 'add_index()' - Append an attribute to the request index.
+//
+
+static bool				// O - `true` on success, `false` on error
+add_index(pappl_client_t  *client,	// I - Client
+          ipp_attribute_t *attr)	// I - Attribute
+{
+  const char		*name;		// Attribute name
+  _pappl_attr_index_t	*entry;		// New entry
+
+
+  if ((name = ippGetName(attr)) == NULL)
+    return (true);			// Skip separators
+
+  if (client->num_attr_index >= client->alloc_attr_index)
+  {
+    // Grow the index...
+    size_t alloc_index = client->alloc_attr_index ? 2 * client->alloc_attr_index : 64;
+					// New size of index
+
+    if ((entry = realloc(client->attr_index, alloc_index * sizeof(_pappl_attr_index_t))) == NULL)
+    {
+      papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for request attribute index.");
+      return (false);
+    }
+
+    client->attr_index       = entry;
+    client->alloc_attr_index = alloc_index;
+
+    _papplClientUpdateMemory(client);
+  }
+
+  entry        = client->attr_index + client->num_attr_index;
+  entry->name  = name;
+  entry->order = client->num_attr_index;
+  entry->attr  = attr;
+
+  client->num_attr_index ++;
+
+  return (true);
+}
+
+
+//
+// 'compare_index()' - Compare two request index entries.
+//
+
+static int				// O - Result of comparison
+compare_index(_pappl_attr_index_t *a,	// I - First entry
+              _pappl_attr_index_t *b)	// I - Second entry
+{
+  int	result;				// Result of comparison
+
+
+  if ((result = strcasecmp(a->name, b->name)) == 0)
+  {
+    if (a->order < b->order)
+      result = -1;
+    else if (a->order > b->order)
+      result = 1;
+  }
+
+  return (result);
+}
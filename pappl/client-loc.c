@@ -30,7 +30,7 @@ papplClientGetLoc(
 		*ptr;			// Pointer into temp string
 
     // Look up language
-    if ((language = ippGetString(ippFindAttribute(client->request, "attributes-natural-language", IPP_TAG_LANGUAGE), 0, NULL)) != NULL)
+    if ((language = ippGetString(_papplClientFindAttribute(client, "attributes-natural-language", IPP_TAG_LANGUAGE), 0, NULL)) != NULL)
     {
       // Use IPP language specification...
       papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Using IPP language code '%s' for localization.", language);
@@ -19,6 +19,13 @@
 // Client structure...
 //
 
+typedef struct _pappl_attr_index_s	// Request attribute index entry
+{
+  const char		*name;			// Attribute name
+  size_t		order;			// Order in request
+  ipp_attribute_t	*attr;			// Attribute
+} _pappl_attr_index_t;
+
 struct _pappl_client_s			// Client data
 {
   pappl_system_t	*system;		// Containing system
@@ -27,6 +34,14 @@ struct _pappl_client_s			// Client data
   http_t		*http;			// HTTP connection
   ipp_t			*request,		// IPP request
 			*response;		// IPP response
+  _pappl_attr_index_t	*attr_index;		// Request attribute index
+  size_t		num_attr_index,		// Number of index entries
+			alloc_attr_index;	// Allocated index entries
+  char			*htmlbuf;		// Captured HTML output
+  size_t		htmlused,		// Bytes used in HTML buffer
+			htmlsize;		// Size of HTML buffer
+  bool			htmlcapture;		// Capture HTML output?
+  size_t		memused;		// Bytes recorded for memory accounting
   time_t		start;			// Request start time
   http_state_t		operation;		// Request operation
   ipp_op_t		operation_id;		// IPP operation-id
@@ -53,17 +68,25 @@ struct _pappl_client_s			// Client data
 
 extern void		_papplClientCleanTempFiles(pappl_client_t *client) _PAPPL_PRIVATE;
 extern pappl_client_t	*_papplClientCreate(pappl_system_t *system, int sock) _PAPPL_PRIVATE;
+extern int		_papplClientCreateTempFd(pappl_client_t *client, const char **filename) _PAPPL_PRIVATE;
 extern char		*_papplClientCreateTempFile(pappl_client_t *client, const void *data, size_t datasize) _PAPPL_PRIVATE;
 extern void		_papplClientDelete(pappl_client_t *client) _PAPPL_PRIVATE;
+extern ipp_attribute_t	*_papplClientFindAttribute(pappl_client_t *client, const char *name, ipp_tag_t value_tag) _PAPPL_PRIVATE;
 extern void		_papplClientFlushDocumentData(pappl_client_t *client) _PAPPL_PRIVATE;
 extern const char	*_papplClientGetAuthWebScheme(pappl_client_t *client) _PAPPL_PRIVATE;
 extern bool		_papplClientHaveDocumentData(pappl_client_t *client) _PAPPL_PRIVATE;
 extern http_status_t	_papplClientIsAuthorizedForGroup(pappl_client_t *client, bool allow_remote, const char *group, gid_t groupid) _PAPPL_PUBLIC;
+extern void		_papplClientIndexAttribute(pappl_client_t *client, ipp_attribute_t *attr) _PAPPL_PRIVATE;
 extern bool		_papplClientProcessHTTP(pappl_client_t *client) _PAPPL_PRIVATE;
 extern bool		_papplClientProcessIPP(pappl_client_t *client) _PAPPL_PRIVATE;
+extern bool		_papplClientRespondETag(pappl_client_t *client, http_status_t code, const char *content_encoding, const char *type, time_t last_modified, const char *etag, size_t length) _PAPPL_PRIVATE;
 extern void		*_papplClientRun(pappl_client_t *client) _PAPPL_PRIVATE;
+extern void		_papplClientUpdateMemory(pappl_client_t *client) _PAPPL_PRIVATE;
+extern const char	*_papplClientHTMLEndCapture(pappl_client_t *client, size_t *length) _PAPPL_PRIVATE;
 extern void		_papplClientHTMLInfo(pappl_client_t *client, bool is_form, const char *dns_sd_name, const char *location, const char *geo_location, const char *organization, const char *org_unit, pappl_contact_t *contact);
 extern void		_papplClientHTMLPutLinks(pappl_client_t *client, cups_array_t *links, pappl_loptions_t which);
+extern void		_papplClientHTMLStartCapture(pappl_client_t *client) _PAPPL_PRIVATE;
+extern void		_papplClientHTMLWrite(pappl_client_t *client, const char *s, size_t slen) _PAPPL_PRIVATE;
 
 
 #endif // !_PAPPL_CLIENT_PRIVATE_H_
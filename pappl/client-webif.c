@@ -16,6 +16,23 @@
 #include <math.h>
 
 
+//
+// Local constants...
+//
+
+#define _PAPPL_FORM_BUFSIZE	65536	// Size of multipart form data buffer
+#define _PAPPL_FORM_MAX_URLENCODED (2 * 1024 * 1024)
+					// Maximum size of URL-encoded form data
+#define _PAPPL_FORM_MAX_VALUE	65536	// Maximum size of multipart form values
+
+
+//
+// Local functions...
+//
+
+static cups_len_t	get_multipart_form(pappl_client_t *client, const char *boundary, cups_option_t **form);
+
+
 //
 // 'papplClientGetCookie()' - Get a cookie from the client.
 //
@@ -122,7 +139,11 @@ papplClientGetCookie(
 // 'papplClientGetForm()' - Get form data from the web client.
 //
 // For HTTP GET requests, the form data is collected from the request URI.  For
-// HTTP POST requests, the form data is read from the client.
+// HTTP POST requests, the form data is read from the client.  Files in
+// "multipart/form-data" requests are saved to temporary files as they are
+// read, subject to the limit set with @link papplSystemSetMaxFormSize@.  Invalid
+// or truncated "multipart/form-data" requests, and requests that exceed the
+// limit, return `0` and no form variables.
 //
 // The returned form values must be freed using the @code cupsFreeOptions@
 // function.
@@ -177,6 +198,11 @@ papplClientGetForm(
     body_size    = strlen(body);
     content_type = "application/x-www-form-urlencoded";
   }
+  else if (content_type && !strncmp(content_type, "multipart/form-data; ", 21) && (boundary = strstr(content_type, "boundary=")) != NULL)
+  {
+    // Stream multi-part form data from the client...
+    return ((int)get_multipart_form(client, boundary + 9, form));
+  }
   else
   {
     // Read up to 2MB of data from the client...
@@ -199,7 +225,7 @@ papplClientGetForm(
       {
         char *temp;			// Temporary pointer
 
-        if (body_alloc >= (2 * 1024 * 1024))
+        if (body_alloc >= _PAPPL_FORM_MAX_URLENCODED)
           break;
 
         body_alloc += 65536;
@@ -302,117 +328,6 @@ papplClientGetForm(
       num_form = cupsAddOption(name, value, num_form, form);
     }
   }
-  else if (!strncmp(content_type, "multipart/form-data; ", 21) && (boundary = strstr(content_type, "boundary=")) != NULL)
-  {
-    // Read multi-part form data...
-    char	name[1024],		// Form variable name
-		filename[1024],		// Form filename
-		bstring[256],		// Boundary string to look for
-		*bend,			// End of value (boundary)
-		*line,			// Start of line
-		*ptr;			// Pointer into name/filename
-    size_t	blen;			// Length of boundary string
-
-    // Format the boundary string we are looking for...
-    snprintf(bstring, sizeof(bstring), "\r\n--%s", boundary + 9);
-    blen = strlen(bstring);
-
-    // Parse lines in the message body...
-    name[0] = '\0';
-    filename[0] = '\0';
-
-    for (bodyptr = body; bodyptr < bodyend;)
-    {
-      // Split out a line...
-      for (line = bodyptr; bodyptr < bodyend; bodyptr ++)
-      {
-        if (!memcmp(bodyptr, "\r\n", 2))
-        {
-          *bodyptr = '\0';
-          bodyptr += 2;
-          break;
-        }
-      }
-
-      if (bodyptr >= bodyend)
-        break;
-
-      papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Line '%s'.", line);
-
-      if (!*line)
-      {
-        // End of headers, grab value...
-        if (!name[0])
-        {
-          // No name value...
-	  papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Invalid multipart form data.");
-	  break;
-	}
-
-	for (bend = bodyend - blen, ptr = memchr(bodyptr, '\r', (size_t)(bend - bodyptr)); ptr; ptr = memchr(ptr + 1, '\r', (size_t)(bend - ptr - 1)))
-	{
-	  // Check for boundary string...
-	  if (!memcmp(ptr, bstring, blen))
-	    break;
-	}
-
-	if (!ptr)
-	{
-	  // No boundary string, invalid data...
-	  papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Invalid multipart form data.");
-	  break;
-	}
-
-        // Point to the start of the boundary string...
-	bend    = ptr;
-        ptr     = bodyptr;
-        bodyptr = bend + blen;
-
-	if (filename[0])
-	{
-	  // Save an embedded file...
-          const char *tempfile;		// Temporary file
-
-	  if ((tempfile = _papplClientCreateTempFile(client, ptr, (size_t)(bend - ptr))) == NULL)
-	    break;
-
-          num_form = cupsAddOption(name, tempfile, num_form, form);
-	}
-	else
-	{
-	  // Save the form variable...
-	  *bend = '\0';
-
-          num_form = cupsAddOption(name, ptr, num_form, form);
-	}
-
-	name[0]     = '\0';
-	filename[0] = '\0';
-
-        if (bodyptr < (bodyend - 1) && bodyptr[0] == '\r' && bodyptr[1] == '\n')
-          bodyptr += 2;
-      }
-      else if (!strncasecmp(line, "Content-Disposition:", 20))
-      {
-	if ((ptr = strstr(line + 20, " name=\"")) != NULL)
-	{
-	  papplCopyString(name, ptr + 7, sizeof(name));
-
-	  if ((ptr = strchr(name, '\"')) != NULL)
-	    *ptr = '\0';
-	}
-
-	if ((ptr = strstr(line + 20, " filename=\"")) != NULL)
-	{
-	  papplCopyString(filename, ptr + 11, sizeof(filename));
-
-	  if ((ptr = strchr(filename, '\"')) != NULL)
-	    *ptr = '\0';
-	}
-      }
-    }
-  }
-
   free(body);
 
   // Return whatever we got...
@@ -561,6 +476,25 @@ papplClientHTMLAuthorize(
 }
 
 
+//
+// '_papplClientHTMLEndCapture()' - Stop capturing HTML output.
+//
+// The returned buffer is owned by the client and remains valid until the next
+// call to @link _papplClientHTMLStartCapture@.
+//
+
+const char *				// O - Captured HTML
+_papplClientHTMLEndCapture(
+    pappl_client_t *client,		// I - Client
+    size_t         *length)		// O - Length of captured HTML
+{
+  client->htmlcapture = false;
+  *length             = client->htmlused;
+
+  return (client->htmlbuf ? client->htmlbuf : "");
+}
+
+
 //
 // 'papplClientHTMLEscape()' - Send a string to a web browser client.
 //
@@ -587,14 +521,14 @@ papplClientHTMLEscape(
     if (*s == '&' || *s == '<' || *s == '\"')
     {
       if (s > start)
-        httpWrite(client->http, start, (size_t)(s - start));
+        _papplClientHTMLWrite(client, start, (size_t)(s - start));
 
       if (*s == '&')
-        httpWrite(client->http, "&amp;", 5);
+        _papplClientHTMLWrite(client, "&amp;", 5);
       else if (*s == '<')
-        httpWrite(client->http, "&lt;", 4);
+        _papplClientHTMLWrite(client, "&lt;", 4);
       else
-        httpWrite(client->http, "&quot;", 6);
+        _papplClientHTMLWrite(client, "&quot;", 6);
 
       start = s + 1;
     }
@@ -603,7 +537,7 @@ papplClientHTMLEscape(
   }
 
   if (s > start)
-    httpWrite(client->http, start, (size_t)(s - start));
+    _papplClientHTMLWrite(client, start, (size_t)(s - start));
 }
 
 
@@ -1026,14 +960,14 @@ papplClientHTMLPrintf(
     if (*format == '%')
     {
       if (format > start)
-        httpWrite(client->http, start, (size_t)(format - start));
+        _papplClientHTMLWrite(client, start, (size_t)(format - start));
 
       tptr    = tformat;
       *tptr++ = *format++;
 
       if (*format == '%')
       {
-        httpWrite(client->http, "%", 1);
+        _papplClientHTMLWrite(client, "%", 1);
         format ++;
 	start = format;
 	continue;
@@ -1140,7 +1074,7 @@ papplClientHTMLPrintf(
 
 	    snprintf(temp, sizeof(temp), tformat, va_arg(ap, double));
 
-            httpWrite(client->http, temp, strlen(temp));
+            _papplClientHTMLWrite(client, temp, strlen(temp));
 	    break;
 
         case 'B' : // Integer formats
@@ -1164,7 +1098,7 @@ papplClientHTMLPrintf(
 	    else
 	      snprintf(temp, sizeof(temp), tformat, va_arg(ap, int));
 
-            httpWrite(client->http, temp, strlen(temp));
+            _papplClientHTMLWrite(client, temp, strlen(temp));
 	    break;
 
 	case 'p' : // Pointer value
@@ -1173,7 +1107,7 @@ papplClientHTMLPrintf(
 
 	    snprintf(temp, sizeof(temp), tformat, va_arg(ap, void *));
 
-            httpWrite(client->http, temp, strlen(temp));
+            _papplClientHTMLWrite(client, temp, strlen(temp));
 	    break;
 
         case 'c' : // Character or character array
@@ -1200,7 +1134,7 @@ papplClientHTMLPrintf(
   }
 
   if (format > start)
-    httpWrite(client->http, start, (size_t)(format - start));
+    _papplClientHTMLWrite(client, start, (size_t)(format - start));
 
   va_end(ap);
 }
@@ -1260,7 +1194,23 @@ papplClientHTMLPuts(
     const char     *s)			// I - String
 {
   if (client && s && *s)
-    httpWrite(client->http, s, strlen(s));
+    _papplClientHTMLWrite(client, s, strlen(s));
+}
+
+
+//
+// '_papplClientHTMLStartCapture()' - Start capturing HTML output.
+//
+// While capturing, HTML sent with the papplClientHTML functions is appended
+// to a buffer instead of being written to the client connection.
+//
+
+void
+_papplClientHTMLStartCapture(
+    pappl_client_t *client)		// I - Client
+{
+  client->htmlcapture = true;
+  client->htmlused    = 0;
 }
 
 
@@ -1299,6 +1249,55 @@ papplClientHTMLStartForm(
 }
 
 
+//
+// '_papplClientHTMLWrite()' - Write HTML to the client or capture buffer.
+//
+
+void
+_papplClientHTMLWrite(
+    pappl_client_t *client,		// I - Client
+    const char     *s,			// I - String to write
+    size_t         slen)		// I - Number of bytes to write
+{
+  if (!client->htmlcapture)
+  {
+    httpWrite(client->http, s, slen);
+    return;
+  }
+
+  if ((client->htmlused + slen) > client->htmlsize)
+  {
+    // Grow the capture buffer...
+    char	*temp;			// New buffer
+    size_t	tempsize = client->htmlsize ? 2 * client->htmlsize : 4096;
+					// New buffer size
+
+    while (tempsize < (client->htmlused + slen))
+      tempsize *= 2;
+
+    if ((temp = realloc(client->htmlbuf, tempsize)) == NULL)
+    {
+      // Out of memory, send what we have and stop capturing...
+      papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for HTML output.");
+      httpWrite(client->http, client->htmlbuf, client->htmlused);
+      httpWrite(client->http, s, slen);
+
+      client->htmlcapture = false;
+      client->htmlused    = 0;
+      return;
+    }
+
+    client->htmlbuf  = temp;
+    client->htmlsize = tempsize;
+
+    _papplClientUpdateMemory(client);
+  }
+
+  memcpy(client->htmlbuf + client->htmlused, s, slen);
+  client->htmlused += slen;
+}
+
+
 //
 // 'papplClientIsValidForm()' - Validate HTML form variables.
 //
@@ -1376,3 +1375,286 @@ papplClientSetCookie(
     httpSetCookie(client->http, buffer);
   }
 }
+
+
+//
+// 'get_multipart_form()' - Read multi-part form data from the client.
+//
+// Form data is processed as it is read, so only the current buffer of data and
+// the (small) form variable values are kept in memory.  Embedded files are
+// written directly to temporary files.
+//
+// If the form data is invalid, truncated, or exceeds the configured limits, no
+// form variables are returned and any temporary files are removed.
+//
+
+static cups_len_t			// O - Number of form variables
+get_multipart_form(
+    pappl_client_t *client,		// I - Client
+    const char     *boundary,		// I - Boundary value
+    cups_option_t  **form)		// O - Form variables
+{
+  cups_len_t	num_form = 0;		// Number of form variables
+  http_state_t	initial_state;		// Initial HTTP state
+  char		*buffer,		// Data buffer
+		*bufptr,		// Pointer into buffer
+		*bufend,		// End of data in buffer
+		*value,			// Form variable value
+		*line,			// Start of line
+		*ptr,			// Pointer into line/buffer
+		name[1024],		// Form variable name
+		filename[1024],		// Form filename
+		bstring[256];		// Boundary string to look for
+  size_t	blen,			// Length of boundary string
+		valuelen = 0,		// Length of form variable value
+		total = 0,		// Total bytes read
+		max_size = client->system->max_form_size;
+					// Maximum bytes to read
+  ssize_t	bytes;			// Bytes read
+  int		fd = -1,		// Temporary file for embedded file
+		num_files = client->num_files;
+					// Initial number of temporary files
+  const char	*tempfile = NULL;	// Temporary filename
+  bool		eof = false,		// End of data?
+		done = false,		// Done parsing?
+		in_value = false,	// Reading a value?
+		after_boundary = false;	// Just read a boundary string?
+
+
+  *form         = NULL;
+  initial_state = httpGetState(client->http);
+
+  // Allocate memory...
+  buffer = malloc(_PAPPL_FORM_BUFSIZE);
+  value  = malloc(_PAPPL_FORM_MAX_VALUE);
+
+  if (!buffer || !value)
+  {
+    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for form data.");
+    free(buffer);
+    free(value);
+    httpFlush(client->http);
+    return (0);
+  }
+
+  // Format the boundary string we are looking for...
+  snprintf(bstring, sizeof(bstring), "\r\n--%s", boundary);
+  blen = strlen(bstring);
+
+  name[0]     = '\0';
+  filename[0] = '\0';
+  bufptr      = buffer;
+  bufend      = buffer;
+
+  while (!done)
+  {
+    bool need_data = false;		// Need more data?
+
+    if (in_value)
+    {
+      // Look for the boundary string, or the start of one at the end of the
+      // buffer...
+      char	*end;			// End of value data
+
+      for (ptr = memchr(bufptr, '\r', (size_t)(bufend - bufptr)); ptr; ptr = memchr(ptr + 1, '\r', (size_t)(bufend - ptr - 1)))
+      {
+        if (!memcmp(ptr, bstring, (size_t)(bufend - ptr) < blen ? (size_t)(bufend - ptr) : blen))
+          break;
+      }
+
+      end = ptr ? ptr : bufend;
+
+      // Save the value data we have so far...
+      if (fd >= 0)
+      {
+        if (end > bufptr && write(fd, bufptr, (size_t)(end - bufptr)) < 0)
+        {
+	  papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to write to temporary file: %s", strerror(errno));
+	  break;
+        }
+      }
+      else if ((valuelen + (size_t)(end - bufptr)) < _PAPPL_FORM_MAX_VALUE)
+      {
+        memcpy(value + valuelen, bufptr, (size_t)(end - bufptr));
+        valuelen += (size_t)(end - bufptr);
+      }
+      else
+      {
+	papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Form variable '%s' is too long.", name);
+	break;
+      }
+
+      if (ptr && (size_t)(bufend - ptr) >= blen)
+      {
+        // Found the boundary, save the form variable...
+        if (fd >= 0)
+        {
+          close(fd);
+          fd = -1;
+
+          num_form = cupsAddOption(name, tempfile, num_form, form);
+        }
+        else
+        {
+          value[valuelen] = '\0';
+
+          num_form = cupsAddOption(name, value, num_form, form);
+        }
+
+	name[0]        = '\0';
+	filename[0]    = '\0';
+	bufptr         = ptr + blen;
+	in_value       = false;
+	after_boundary = true;
+      }
+      else
+      {
+        bufptr    = end;
+        need_data = true;
+      }
+    }
+    else if (after_boundary)
+    {
+      // A boundary string is followed by CR LF or "--" for the last one...
+      if ((bufend - bufptr) < 2)
+      {
+        need_data = true;
+      }
+      else
+      {
+        if (!memcmp(bufptr, "--", 2))
+          done = true;
+
+        bufptr += 2;
+        after_boundary = false;
+      }
+    }
+    else
+    {
+      // Split out a line...
+      for (ptr = memchr(bufptr, '\r', (size_t)(bufend - bufptr)); ptr; ptr = memchr(ptr + 1, '\r', (size_t)(bufend - ptr - 1)))
+      {
+        if (ptr < (bufend - 1) && ptr[1] == '\n')
+          break;
+      }
+
+      if (!ptr)
+      {
+        if (bufptr == buffer && bufend == (buffer + _PAPPL_FORM_BUFSIZE))
+        {
+	  papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Invalid multipart form data.");
+	  break;
+        }
+
+        need_data = true;
+      }
+      else
+      {
+        *ptr   = '\0';
+        line   = bufptr;
+        bufptr = ptr + 2;
+
+	papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Line '%s'.", line);
+
+	if (!*line)
+	{
+	  // End of headers, grab value...
+	  if (!name[0])
+	  {
+	    // No name value...
+	    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Invalid multipart form data.");
+	    break;
+	  }
+
+	  if (filename[0] && (fd = _papplClientCreateTempFd(client, &tempfile)) < 0)
+	    break;
+
+	  in_value = true;
+	  valuelen = 0;
+	}
+	else if (!strncasecmp(line, "Content-Disposition:", 20))
+	{
+	  if ((ptr = strstr(line + 20, " name=\"")) != NULL)
+	  {
+	    papplCopyString(name, ptr + 7, sizeof(name));
+
+	    if ((ptr = strchr(name, '\"')) != NULL)
+	      *ptr = '\0';
+	  }
+
+	  if ((ptr = strstr(line + 20, " filename=\"")) != NULL)
+	  {
+	    papplCopyString(filename, ptr + 11, sizeof(filename));
+
+	    if ((ptr = strchr(filename, '\"')) != NULL)
+	      *ptr = '\0';
+	  }
+	}
+      }
+    }
+
+    if (need_data)
+    {
+      if (eof)
+      {
+	papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Invalid multipart form data.");
+        break;
+      }
+
+      // Move any unprocessed data to the front of the buffer and read more...
+      if (bufptr > buffer)
+      {
+        memmove(buffer, bufptr, (size_t)(bufend - bufptr));
+        bufend -= bufptr - buffer;
+        bufptr = buffer;
+      }
+
+      if ((bytes = httpRead(client->http, bufend, (size_t)(buffer + _PAPPL_FORM_BUFSIZE - bufend))) > 0)
+      {
+        bufend += bytes;
+        total  += (size_t)bytes;
+
+        if (max_size > 0 && total > max_size)
+        {
+	  papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Form data is larger than %lu bytes.", (unsigned long)max_size);
+	  break;
+        }
+      }
+      else
+      {
+        eof = true;
+      }
+    }
+  }
+
+  papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Read %ld bytes of form data (multipart/form-data).", (long)total);
+
+  // Clean up...
+  if (fd >= 0)
+    close(fd);
+
+  free(buffer);
+  free(value);
+
+  if (!done)
+  {
+    // Don't return a partial form...
+    cupsFreeOptions(num_form, *form);
+    num_form = 0;
+    *form    = NULL;
+
+    while (client->num_files > num_files)
+    {
+      client->num_files --;
+      unlink(client->files[client->num_files]);
+      free(client->files[client->num_files]);
+      client->files[client->num_files] = NULL;
+    }
+  }
+
+  // Flush remaining data...
+  if (httpGetState(client->http) == initial_state)
+    httpFlush(client->http);
+
+  return (num_form);
+}
@@ -70,6 +70,8 @@ _papplClientCreate(
 
   client->system = system;
 
+  _papplClientUpdateMemory(client);
+
   pthread_rwlock_wrlock(&system->rwlock);
   client->number = system->next_client ++;
   pthread_rwlock_unlock(&system->rwlock);
@@ -78,6 +80,7 @@ _papplClientCreate(
   if ((client->http = httpAcceptConnection(sock, 1)) == NULL)
   {
     papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to accept client connection: %s", strerror(errno));
+    _papplSystemUpdateMemory(system, PAPPL_MEMORY_CLIENTS, &client->memused, 0);
     free(client);
     return (NULL);
   }
@@ -91,52 +94,79 @@ _papplClientCreate(
 
 
 //
-// '_papplClientCreateTempFile()' - Create a temporary file.
+// '_papplClientCreateTempFd()' - Create a temporary file for writing.
+//
+// The temporary file is removed when the client's temporary files are cleaned
+// up.
 //
 
-char *					// O - Temporary filename or `NULL` on error
-_papplClientCreateTempFile(
+int					// O - File descriptor or `-1` on error
+_papplClientCreateTempFd(
     pappl_client_t *client,		// I - Client
-    const void     *data,		// I - Data
-    size_t         datasize)		// I - Size of data
+    const char     **filename)		// O - Temporary filename
 {
   int	fd;				// File descriptor
   char	tempfile[1024];			// Temporary filename
 
 
+  *filename = NULL;
+
   // See if we have room for another temp file...
   if (client->num_files >= (int)(sizeof(client->files) / sizeof(client->files[0])))
   {
     papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Too many temporary files.");
-    return (NULL);
+    return (-1);
   }
 
-  // Write the data to a temporary file...
+  // Create the temporary file...
   if ((fd = cupsTempFd(NULL, NULL, tempfile, sizeof(tempfile))) < 0)
   {
     papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create temporary file: %s", strerror(errno));
-    return (NULL);
+    return (-1);
   }
 
+  if ((client->files[client->num_files] = strdup(tempfile)) == NULL)
+  {
+    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for temporary file: %s", strerror(errno));
+    close(fd);
+    unlink(tempfile);
+    return (-1);
+  }
+
+  *filename = client->files[client->num_files ++];
+
+  return (fd);
+}
+
+
+//
+// '_papplClientCreateTempFile()' - Create a temporary file.
+//
+
+char *					// O - Temporary filename or `NULL` on error
+_papplClientCreateTempFile(
+    pappl_client_t *client,		// I - Client
+    const void     *data,		// I - Data
+    size_t         datasize)		// I - Size of data
+{
+  int		fd;			// File descriptor
+  const char	*tempfile;		// Temporary filename
+
+
+  // Write the data to a temporary file...
+  if ((fd = _papplClientCreateTempFd(client, &tempfile)) < 0)
+    return (NULL);
+
   if (write(fd, data, datasize) < 0)
   {
     papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to write to temporary file: %s", strerror(errno));
     close(fd);
-    unlink(tempfile);
     return (NULL);
   }
 
   close(fd);
 
-  if ((client->files[client->num_files] = strdup(tempfile)) != NULL)
-    client->num_files ++;
-  else
-    unlink(tempfile);
-
-  if (client->num_files > 0)
-    return (client->files[client->num_files - 1]);
-  else
-    return (NULL);
+  return ((char *)tempfile);
 }
 
 
@@ -168,6 +198,11 @@ _papplClientDelete(
   ippDelete(client->request);
   ippDelete(client->response);
 
+  free(client->attr_index);
+  free(client->htmlbuf);
+
+  _papplSystemUpdateMemory(client->system, PAPPL_MEMORY_CLIENTS, &client->memused, 0);
+
   free(client);
 
   // Update the number of active clients...
@@ -208,6 +243,8 @@ _papplClientProcessHTTP(
   client->response  = NULL;
   client->operation = HTTP_STATE_WAITING;
 
+  client->num_attr_index = 0;
+
   // Read a request from the connection...
   while ((http_state = httpReadRequest(client->http, uri, sizeof(uri))) == HTTP_STATE_WAITING)
     usleep(1);
@@ -352,9 +389,9 @@ _papplClientProcessHTTP(
         if ((resource = _papplSystemFindResourceForPath(client->system, client->uri)) != NULL)
         {
           if (eval_if_modified(client, resource))
-	    return (papplClientRespond(client, HTTP_STATUS_OK, NULL, resource->format, resource->last_modified, 0));
+	    return (_papplClientRespondETag(client, HTTP_STATUS_OK, NULL, resource->format, resource->last_modified, resource->etag, 0));
           else
-            return (papplClientRespond(client, HTTP_STATUS_NOT_MODIFIED, NULL, NULL, resource->last_modified, 0));
+            return (_papplClientRespondETag(client, HTTP_STATUS_NOT_MODIFIED, NULL, NULL, resource->last_modified, resource->etag, 0));
 	}
 
         // If we get here the resource wasn't found...
@@ -366,7 +403,7 @@ _papplClientProcessHTTP(
         {
           if (!eval_if_modified(client, resource))
           {
-            return (papplClientRespond(client, HTTP_STATUS_NOT_MODIFIED, NULL, NULL, resource->last_modified, 0));
+            return (_papplClientRespondETag(client, HTTP_STATUS_NOT_MODIFIED, NULL, NULL, resource->last_modified, resource->etag, 0));
           }
           else if (resource->cb)
           {
@@ -401,7 +438,7 @@ _papplClientProcessHTTP(
 	  else
 	  {
 	    // Send a static resource file...
-	    if (!papplClientRespond(client, HTTP_STATUS_OK, NULL, resource->format, resource->last_modified, resource->length))
+	    if (!_papplClientRespondETag(client, HTTP_STATUS_OK, NULL, resource->format, resource->last_modified, resource->etag, resource->length))
 	      return (false);
 
 	    httpWrite(client->http, (const char *)resource->data, resource->length);
@@ -488,6 +525,24 @@ papplClientRespond(
     const char     *type,		// I - MIME media type of response
     time_t         last_modified,	// I - Last-Modified date/time or `0` for none
     size_t         length)		// I - Length of response or `0` for variable-length
+{
+  return (_papplClientRespondETag(client, code, content_encoding, type, last_modified, NULL, length));
+}
+
+
+//
+// '_papplClientRespondETag()' - Send a HTTP response with an optional entity tag.
+//
+
+bool					// O - `true` on success, `false` on failure
+_papplClientRespondETag(
+    pappl_client_t *client,		// I - Client
+    http_status_t  code,		// I - HTTP status of response
+    const char     *content_encoding,	// I - Content-Encoding of response
+    const char     *type,		// I - MIME media type of response
+    time_t         last_modified,	// I - Last-Modified date/time or `0` for none
+    const char     *etag,		// I - Strong entity tag or `NULL` for none
+    size_t         length)		// I - Length of response or `0` for variable-length
 {
   char	message[1024],			// Text message
 	last_str[256];			// Date string
@@ -520,6 +575,13 @@ papplClientRespond(
   httpSetField(client->http, HTTP_FIELD_SERVER, papplSystemGetServerHeader(client->system));
   if (last_modified)
     httpSetField(client->http, HTTP_FIELD_LAST_MODIFIED, httpGetDateString(last_modified, last_str, sizeof(last_str)));
+#ifdef HAVE_HTTP_FIELD_ETAG
+  if (etag && *etag)
+    httpSetField(client->http, HTTP_FIELD_ETAG, etag);
+#else
+  // libcups 2.x only sends the header fields it knows about, so no "ETag"...
+  (void)etag;
+#endif // HAVE_HTTP_FIELD_ETAG
 
   if (code == HTTP_STATUS_METHOD_NOT_ALLOWED || client->operation == HTTP_STATE_OPTIONS)
     httpSetField(client->http, HTTP_FIELD_ALLOW, "GET, HEAD, OPTIONS, POST");
@@ -677,7 +739,24 @@ _papplClientRun(
 
 
 //
-// 'eval_if_modified()' - Evaluate an "If-Modified-Since" header.
+// '_papplClientUpdateMemory()' - Update the memory used by a client.
+//
+
+void
+_papplClientUpdateMemory(
+    pappl_client_t *client)		// I - Client
+{
+  _papplSystemUpdateMemory(client->system, PAPPL_MEMORY_CLIENTS, &client->memused, sizeof(pappl_client_t) + client->htmlsize + client->alloc_attr_index * sizeof(_pappl_attr_index_t));
+}
+
+
+//
+// 'eval_if_modified()' - Evaluate an "If-None-Match" or "If-Modified-Since"
+//                         header.
+//
+// "If-None-Match" takes precedence over "If-Modified-Since" as required by
+// RFC 9110.  libcups 2.x discards header fields it doesn't know about, so
+// "If-None-Match" is never seen and only "If-Modified-Since" is used with it.
 //
 
 static bool				// O - `true` if modified, `false` otherwise
@@ -694,10 +773,42 @@ eval_if_modified(
   if (r->cb)
     return (true);
 
+#ifdef HAVE_HTTP_FIELD_ETAG
+  // Get "If-None-Match:" header
+  ptr = httpGetField(client->http, HTTP_FIELD_IF_NONE_MATCH);
+
+  if (ptr && *ptr)
+  {
+    size_t	etaglen = strlen(r->etag);
+					// Length of entity tag
+
+    // Compare against each entity tag in the list...
+    while (r->etag[0] && *ptr)
+    {
+      while (isspace(*ptr & 255) || *ptr == ',')
+        ptr ++;
+
+      if (*ptr == '*')
+        return (false);
+
+      if (!strncmp(ptr, "W/", 2))
+        ptr += 2;			// Use weak comparison
+
+      if (!strncmp(ptr, r->etag, etaglen) && (!ptr[etaglen] || ptr[etaglen] == ',' || isspace(ptr[etaglen] & 255)))
+        return (false);
+
+      while (*ptr && *ptr != ',')
+        ptr ++;
+    }
+
+    return (true);
+  }
+#endif // HAVE_HTTP_FIELD_ETAG
+
   // Get "If-Modified-Since:" header
   ptr = httpGetField(client->http, HTTP_FIELD_IF_MODIFIED_SINCE);
 
-  if (*ptr == '\0')
+  if (!ptr || *ptr == '\0')
     return (true);
 
   // Decode the If-Modified-Since: header...
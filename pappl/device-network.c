@@ -29,6 +29,7 @@
 
 #define _PAPPL_MAX_SNMP_SUPPLY	32	// Maximum number of SNMP supplies
 #define _PAPPL_SNMP_TIMEOUT	2.0	// Timeout for SNMP queries
+#define _PAPPL_PROBE_TIMEOUT	1000	// Timeout for reachability probes in milliseconds
 
 // Generic enum values
 #define _PAPPL_TC_other			1
@@ -125,6 +126,13 @@ typedef struct _pappl_snmp_dev_s	// SNMP browse data
   int		port;				// Port number
 } _pappl_snmp_dev_t;
 
+typedef struct _pappl_snmp_cache_s	// SNMP device address cache
+{
+  char		*uri,				// Device URI
+		*host;				// Numeric address of device
+  int		port;				// Port number
+} _pappl_snmp_cache_t;
+
 typedef enum _pappl_snmp_query_e	// SNMP query request IDs for each field
 {
   _PAPPL_SNMP_QUERY_DEVICE_TYPE = 0x01,		// Device type OID
@@ -138,6 +146,11 @@ typedef enum _pappl_snmp_query_e	// SNMP query request IDs for each field
 // Local globals...
 //
 
+static cups_array_t	*snmp_cache = NULL;
+					// Last known SNMP device addresses
+static pthread_mutex_t	snmp_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+					// Mutex for SNMP device address cache
+
 static const int	DevicePrinterOID[] = { 1,3,6,1,2,1,25,3,1,5,-1 };
 					// Host MIB OID for "printer" type
 static const int	SysNameOID[] = { 1,3,6,1,2,1,1,5,0,-1 };
@@ -191,15 +204,21 @@ static int		pappl_dnssd_compare_devices(_pappl_dns_sd_dev_t *a, _pappl_dns_sd_de
 static void		pappl_dnssd_free(_pappl_dns_sd_dev_t *d);
 static _pappl_dns_sd_dev_t *pappl_dnssd_get_device(cups_array_t *devices, const char *serviceName, const char *replyDomain);
 static bool		pappl_dnssd_list(pappl_device_cb_t cb, void *data, pappl_deverror_cb_t err_cb, void *err_data);
+static bool		pappl_dnssd_resolve(pappl_device_t *device, const char *device_uri, char *host, _pappl_socket_t *sock, int msecs);
 static void		pappl_dnssd_unescape(char *dst, const char *src, size_t dstsize);
 #endif // HAVE_DNSSD
 
 
+static int		pappl_snmp_cache_compare(_pappl_snmp_cache_t *a, _pappl_snmp_cache_t *b);
+static void		pappl_snmp_cache_free(_pappl_snmp_cache_t *c);
+static bool		pappl_snmp_cache_get(const char *device_uri, char *host, size_t hostsize, int *port);
+static void		pappl_snmp_cache_set(const char *device_uri, const char *host, int port);
 static int		pappl_snmp_compare_devices(_pappl_snmp_dev_t *a, _pappl_snmp_dev_t *b);
 static bool		pappl_snmp_find(pappl_device_cb_t cb, void *data, _pappl_socket_t *sock, pappl_deverror_cb_t err_cb, void *err_data);
 static void		pappl_snmp_free(_pappl_snmp_dev_t *d);
 static http_addrlist_t	*pappl_snmp_get_interface_addresses(void);
 static bool		pappl_snmp_list(pappl_device_cb_t cb, void *data, pappl_deverror_cb_t err_cb, void *err_data);
+static bool		pappl_snmp_open_cached(const char *device_uri, _pappl_socket_t *sock);
 static bool		pappl_snmp_open_cb(const char *device_info, const char *device_uri, const char *device_id, void *data);
 static void		pappl_snmp_read_response(cups_array_t *devices, int fd, pappl_deverror_cb_t err_cb, void *err_data);
 static void		pappl_snmp_walk_cb(_pappl_snmp_t *packet, _pappl_socket_t *sock);
@@ -229,6 +248,86 @@ _papplDeviceAddNetworkSchemes(void)
 }
 
 
+//
+// '_papplDeviceProbeNetwork()' - Quickly check whether a network device is reachable.
+//
+// This function resolves the host (and DNS-SD service, if needed) and tries a
+// TCP connection with a short timeout.  "snmp" URIs are checked using the last
+// known address of the device; without one they cannot be checked without a
+// full discovery, so they are reported as reachable.
+//
+
+bool					// O - `true` if reachable, `false` otherwise
+_papplDeviceProbeNetwork(
+    const char *device_uri)		// I - Device URI
+{
+  _pappl_socket_t	sock;		// Socket device data
+  char			scheme[32],	// URI scheme
+			userpass[32],	// Username/password (not used)
+			host[256],	// Host name or make
+			resource[256],	// Resource path, if any
+			port_str[32];	// String for port number
+  int			port,		// Port number
+			fd = -1;	// Probe socket
+  http_addrlist_t	*list,		// Address list
+			*addr;		// Connected address
+
+
+  memset(&sock, 0, sizeof(sock));
+
+  if (httpSeparateURI(HTTP_URI_CODING_ALL, device_uri, scheme, sizeof(scheme), userpass, sizeof(userpass), host, sizeof(host), &port, resource, sizeof(resource)) < HTTP_URI_STATUS_OK)
+    return (false);
+
+  if (!strcmp(scheme, "dnssd"))
+  {
+#ifdef HAVE_DNSSD
+    if (!pappl_dnssd_resolve(NULL, device_uri, host, &sock, _PAPPL_PROBE_TIMEOUT))
+      return (false);
+#else
+    return (false);
+#endif // HAVE_DNSSD
+  }
+  else if (!strcmp(scheme, "socket"))
+  {
+    sock.host = strdup(host);
+    sock.port = port;
+  }
+  else if (!strcmp(scheme, "snmp") && pappl_snmp_cache_get(device_uri, host, sizeof(host), &port))
+  {
+    sock.host = strdup(host);
+    sock.port = port;
+  }
+  else
+  {
+    // Can't probe this scheme...
+    return (true);
+  }
+
+  if (!sock.host)
+    return (false);
+
+  snprintf(port_str, sizeof(port_str), "%d", sock.port);
+  list = httpAddrGetList(sock.host, AF_UNSPEC, port_str);
+  free(sock.host);
+
+  if (!list)
+    return (false);
+
+  if ((addr = httpAddrConnect(list, &fd, _PAPPL_PROBE_TIMEOUT, NULL)) != NULL && fd >= 0)
+  {
+#if _WIN32
+    closesocket(fd);
+#else
+    close(fd);
+#endif // _WIN32
+  }
+
+  httpAddrFreeList(list);
+
+  return (addr != NULL);
+}
+
+
 #ifdef HAVE_DNSSD
 #  ifdef HAVE_MDNSRESPONDER
 //
@@ -739,6 +838,93 @@ pappl_dnssd_query_cb(
 }
 
 
+//
+// 'pappl_dnssd_resolve()' - Resolve the host and port for a "dnssd" URI.
+//
+// The "host" buffer contains the host portion of the URI and is modified.
+//
+
+static bool				// O - `true` on success, `false` on failure
+pappl_dnssd_resolve(
+    pappl_device_t  *device,		// I - Device for errors or `NULL` for none
+    const char      *device_uri,	// I - Device URI
+    char            *host,		// I - Host portion of URI
+    _pappl_socket_t *sock,		// I - Socket device data
+    int             msecs)		// I - Timeout in milliseconds
+{
+  int			i;		// Looping var
+  char			srvname[256],	// Service name
+			*type,		// Service type
+			*domain;	// Domain
+  _pappl_dns_sd_t	master;		// DNS-SD context
+#  ifdef HAVE_MDNSRESPONDER
+  int			error;		// Error code, if any
+  DNSServiceRef		resolver;	// Resolver
+#  else
+  AvahiServiceResolver	*resolver;	// Resolver
+#  endif // HAVE_MDNSRESPONDER
+
+
+  if ((domain = strstr(host, "._tcp.")) == NULL)
+    return (false);
+
+  // Truncate host at domain portion...
+  domain += 5;
+  *domain++ = '\0';
+
+  // Then separate the service type portion...
+  type = strstr(host, "._");
+  *type ++ = '\0';
+
+  // Unescape the service name...
+  pappl_dnssd_unescape(srvname, host, sizeof(srvname));
+
+  master = _papplDNSSDInit(NULL);
+
+  _PAPPL_DEBUG("pappl_dnssd_resolve: host='%s', srvname='%s', type='%s', domain='%s'\n", host, srvname, type, domain);
+
+#  ifdef HAVE_MDNSRESPONDER
+  resolver = master;
+  if ((error = DNSServiceResolve(&resolver, kDNSServiceFlagsShareConnection, 0, srvname, type, domain, (DNSServiceResolveReply)pappl_dnssd_resolve_cb, sock)) != kDNSServiceErr_NoError)
+  {
+    papplDeviceError(device, "Unable to resolve '%s': %s", device_uri, _papplDNSSDStrError(error));
+    return (false);
+  }
+#  else
+  _papplDNSSDLock();
+
+  if ((resolver = avahi_service_resolver_new(master, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, srvname, type, domain, AVAHI_PROTO_UNSPEC, 0, (AvahiServiceResolverCallback)pappl_dnssd_resolve_cb, sock)) == NULL)
+  {
+    papplDeviceError(device, "Unable to resolve '%s'.", device_uri);
+    _papplDNSSDUnlock();
+    return (false);
+  }
+
+  _papplDNSSDUnlock();
+#  endif // HAVE_MDNSRESPONDER
+
+  // Wait for the resolve to complete...
+  for (i = 0; i < msecs && !sock->host; i ++)
+    usleep(1000);
+
+#  ifdef HAVE_MDNSRESPONDER
+  DNSServiceRefDeallocate(resolver);
+#  else
+  _papplDNSSDLock();
+  avahi_service_resolver_free(resolver);
+  _papplDNSSDUnlock();
+#  endif // HAVE_MDNSRESPONDER
+
+  if (!sock->host)
+  {
+    papplDeviceError(device, "Unable to resolve '%s'.", device_uri);
+    return (false);
+  }
+
+  return (true);
+}
+
+
 //
 // 'pappl_dnssd_resolve_cb()' - Resolve a DNS-SD service.
 //
@@ -847,6 +1033,114 @@ pappl_dnssd_unescape(
 #endif // HAVE_DNSSD
 
 
+//
+// 'pappl_snmp_cache_compare()' - Compare two SNMP device address cache entries.
+//
+
+static int				// O - Result of comparison
+pappl_snmp_cache_compare(
+    _pappl_snmp_cache_t *a,		// I - First entry
+    _pappl_snmp_cache_t *b)		// I - Second entry
+{
+  return (strcmp(a->uri, b->uri));
+}
+
+
+//
+// 'pappl_snmp_cache_free()' - Free an SNMP device address cache entry.
+//
+
+static void
+pappl_snmp_cache_free(
+    _pappl_snmp_cache_t *c)		// I - Cache entry
+{
+  free(c->uri);
+  free(c->host);
+  free(c);
+}
+
+
+//
+// 'pappl_snmp_cache_get()' - Get the last known address of an SNMP device.
+//
+
+static bool				// O - `true` if found, `false` otherwise
+pappl_snmp_cache_get(
+    const char *device_uri,		// I - Device URI
+    char       *host,			// I - Host address buffer
+    size_t     hostsize,		// I - Size of host address buffer
+    int        *port)			// O - Port number
+{
+  _pappl_snmp_cache_t	key,		// Search key
+			*match;		// Matching entry
+
+
+  pthread_mutex_lock(&snmp_cache_mutex);
+
+  key.uri = (char *)device_uri;
+
+  if ((match = (_pappl_snmp_cache_t *)cupsArrayFind(snmp_cache, &key)) != NULL)
+  {
+    papplCopyString(host, match->host, hostsize);
+    *port = match->port;
+  }
+
+  pthread_mutex_unlock(&snmp_cache_mutex);
+
+  return (match != NULL);
+}
+
+
+//
+// 'pappl_snmp_cache_set()' - Save or remove the last known address of an SNMP
+//                            device.
+//
+// Passing a `NULL` host removes any cached address for the device.
+//
+
+static void
+pappl_snmp_cache_set(
+    const char *device_uri,		// I - Device URI
+    const char *host,			// I - Host address or `NULL` to remove
+    int        port)			// I - Port number
+{
+  _pappl_snmp_cache_t	key,		// Search key
+			*match;		// Matching entry
+
+
+  pthread_mutex_lock(&snmp_cache_mutex);
+
+  if (!snmp_cache)
+    snmp_cache = cupsArrayNew((cups_array_cb_t)pappl_snmp_cache_compare, NULL, NULL, 0, NULL, (cups_afree_cb_t)pappl_snmp_cache_free);
+
+  key.uri = (char *)device_uri;
+
+  if ((match = (_pappl_snmp_cache_t *)cupsArrayFind(snmp_cache, &key)) != NULL)
+  {
+    if (host)
+    {
+      free(match->host);
+      match->host = strdup(host);
+      match->port = port;
+    }
+    else
+    {
+      cupsArrayRemove(snmp_cache, match);
+    }
+  }
+  else if (host && (match = (_pappl_snmp_cache_t *)calloc(1, sizeof(_pappl_snmp_cache_t))) != NULL)
+  {
+    match->uri  = strdup(device_uri);
+    match->host = strdup(host);
+    match->port = port;
+
+    cupsArrayAdd(snmp_cache, match);
+  }
+
+  pthread_mutex_unlock(&snmp_cache_mutex);
+}
+
+
 //
 // 'pappl_snmp_compare_devices()' - Compare two SNMP devices.
 //
@@ -963,7 +1257,8 @@ pappl_snmp_find(
   // Report all of the devices we found...
   for (cur_device = (_pappl_snmp_dev_t *)cupsArrayGetFirst(devices); cur_device; cur_device = (_pappl_snmp_dev_t *)cupsArrayGetNext(devices))
   {
-    char	info[256];		// Device description
+    char	info[256],		// Device description
+		address_str[256];	// IP address as a string
     cups_len_t	num_did;		// Number of device ID keys/values
     cups_option_t *did;			// Device ID keys/values
     const char	*make,			// Manufacturer
@@ -989,12 +1284,14 @@ pappl_snmp_find(
     else
       snprintf(info, sizeof(info), "%s %s (Network Printer %s)", make, model, cur_device->uri + 7);
 
+    // Remember the address and port so the device can be opened directly...
+    httpAddrGetString(&cur_device->address, address_str, sizeof(address_str));
+    pappl_snmp_cache_set(cur_device->uri, address_str, cur_device->port);
+
     if ((*cb)(info, cur_device->uri, cur_device->device_id, data))
     {
       // Save the address and port...
-      char	address_str[256];	// IP address as a string
-
-      sock->host = strdup(httpAddrGetString(&cur_device->address, address_str, sizeof(address_str)));
+      sock->host = strdup(address_str);
       sock->port = cur_device->port;
       ret        = true;
       break;
@@ -1105,6 +1402,104 @@ pappl_snmp_list(
 }
 
 
+//
+// 'pappl_snmp_open_cached()' - Connect to an SNMP device at its last known
+//                              address.
+//
+// The device must still report the same sysName that was used to create the
+// device URI, otherwise the cached address is forgotten and `false` is
+// returned so the caller can do a full discovery.
+//
+
+static bool				// O - `true` on success, `false` on failure
+pappl_snmp_open_cached(
+    const char      *device_uri,	// I - Device URI
+    _pappl_socket_t *sock)		// I - Socket device
+{
+  char			host[256],	// Last known address
+			port_str[32];	// String for port number
+  int			port;		// Last known port number
+  struct pollfd		data;		// poll() data
+  _pappl_snmp_t		packet;		// Decoded packet
+  bool			match = false;	// Does the sysName match?
+
+
+  if (!pappl_snmp_cache_get(device_uri, host, sizeof(host), &port))
+    return (false);
+
+  _PAPPL_DEBUG("pappl_snmp_open_cached: Trying '%s:%d' for '%s'.\n", host, port, device_uri);
+
+  sock->fd = -1;
+
+  snprintf(port_str, sizeof(port_str), "%d", port);
+  if ((sock->list = httpAddrGetList(host, AF_UNSPEC, port_str)) == NULL)
+    goto failed;
+
+  sock->addr = httpAddrConnect(sock->list, &sock->fd, 5000, NULL);
+
+  if (!sock->addr || sock->fd < 0)
+    goto failed;
+
+  if ((sock->snmp_fd = _papplSNMPOpen(httpAddrGetFamily(&(sock->addr->addr)))) < 0)
+    goto failed;
+
+  // Make sure this is still the same device...
+  _papplSNMPWrite(sock->snmp_fd, &(sock->addr->addr), _PAPPL_SNMP_VERSION_1, _PAPPL_SNMP_COMMUNITY, _PAPPL_ASN1_GET_REQUEST, _PAPPL_SNMP_QUERY_DEVICE_SYSNAME, SysNameOID);
+
+  data.fd     = sock->snmp_fd;
+  data.events = POLLIN;
+
+  while (poll(&data, 1, 2000) > 0)
+  {
+    if (!_papplSNMPRead(sock->snmp_fd, &packet, -1.0))
+      continue;
+
+    if (packet.error || packet.error_status || packet.request_id != _PAPPL_SNMP_QUERY_DEVICE_SYSNAME || packet.object_type != _PAPPL_ASN1_OCTET_STRING)
+      continue;
+
+    match = !strcmp((char *)packet.object_value.string.bytes, device_uri + 7);
+    break;
+  }
+
+  if (!match)
+    goto failed;
+
+  sock->host = strdup(host);
+  sock->port = port;
+
+  return (true);
+
+  // If we get here the cached address is no longer good...
+  failed:
+
+  _PAPPL_DEBUG("pappl_snmp_open_cached: '%s:%d' is no longer '%s'.\n", host, port, device_uri);
+
+  if (sock->snmp_fd >= 0)
+  {
+    _papplSNMPClose(sock->snmp_fd);
+    sock->snmp_fd = -1;
+  }
+
+  if (sock->fd >= 0)
+  {
+#if _WIN32
+    closesocket(sock->fd);
+#else
+    close(sock->fd);
+#endif // _WIN32
+    sock->fd = -1;
+  }
+
+  httpAddrFreeList(sock->list);
+  sock->list = NULL;
+  sock->addr = NULL;
+
+  pappl_snmp_cache_set(device_uri, NULL, 0);
+
+  return (false);
+}
+
+
 //
 // 'pappl_snmp_open_cb()' - Look for a matching device URI.
 //
@@ -1583,80 +1978,25 @@ pappl_socket_open(
 
   if (!strcmp(scheme, "dnssd"))
   {
-    // DNS-SD discovered device
+    // DNS-SD discovered device; wait up to 30 seconds for the resolve...
 #ifdef HAVE_DNSSD
-    int			i;		// Looping var
-    char		srvname[256],	// Service name
-			*type,		// Service type
-			*domain;	// Domain
-    _pappl_dns_sd_t	master;		// DNS-SD context
-#  ifdef HAVE_MDNSRESPONDER
-    int			error;		// Error code, if any
-    DNSServiceRef	resolver;	// Resolver
-#  else
-    AvahiServiceResolver *resolver;	// Resolver
-#  endif // HAVE_MDNSRESPONDER
-
-    if ((domain = strstr(host, "._tcp.")) != NULL)
-    {
-      // Truncate host at domain portion...
-      domain += 5;
-      *domain++ = '\0';
-
-      // Then separate the service type portion...
-      type = strstr(host, "._");
-      *type ++ = '\0';
-
-      // Unescape the service name...
-      pappl_dnssd_unescape(srvname, host, sizeof(srvname));
-
-      master = _papplDNSSDInit(NULL);
-
-      _PAPPL_DEBUG("pappl_socket_open: host='%s', srvname='%s', type='%s', domain='%s'\n", host, srvname, type, domain);
-
-#  ifdef HAVE_MDNSRESPONDER
-      resolver = master;
-      if ((error = DNSServiceResolve(&resolver, kDNSServiceFlagsShareConnection, 0, srvname, type, domain, (DNSServiceResolveReply)pappl_dnssd_resolve_cb, sock)) != kDNSServiceErr_NoError)
-      {
-	papplDeviceError(device, "Unable to resolve '%s': %s", device_uri, _papplDNSSDStrError(error));
-	goto error;
-      }
-#  else
-      _papplDNSSDLock();
-
-      if ((resolver = avahi_service_resolver_new(master, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, srvname, type, domain, AVAHI_PROTO_UNSPEC, 0, (AvahiServiceResolverCallback)pappl_dnssd_resolve_cb, sock)) == NULL)
-      {
-	papplDeviceError(device, "Unable to resolve '%s'.", device_uri);
-	_papplDNSSDUnlock();
-	goto error;
-      }
-
-      _papplDNSSDUnlock();
-#  endif // HAVE_MDNSRESPONDER
-
-      // Wait up to 30 seconds for the resolve to complete...
-      for (i = 0; i < 30000 && !sock->host; i ++)
-	usleep(1000);
-
-#  ifdef HAVE_MDNSRESPONDER
-      DNSServiceRefDeallocate(resolver);
-#  else
-      _papplDNSSDLock();
-      avahi_service_resolver_free(resolver);
-      _papplDNSSDUnlock();
-#  endif // HAVE_MDNSRESPONDER
-
-      if (!sock->host)
-      {
-	papplDeviceError(device, "Unable to resolve '%s'.", device_uri);
-	goto error;
-      }
-    }
+    if (!pappl_dnssd_resolve(device, device_uri, host, sock, 30000))
+      goto error;
 #endif // HAVE_DNSSD
   }
   else if (!strcmp(scheme, "snmp"))
   {
-    // SNMP discovered device
+    // SNMP discovered device; try the last known address before doing a full
+    // discovery...
+    if (pappl_snmp_open_cached(device_uri, sock))
+    {
+      papplDeviceSetData(device, sock);
+
+      _PAPPL_DEBUG("Connection successful, device fd = %d\n", sock->fd);
+
+      return (true);
+    }
+
     if (!pappl_snmp_find(pappl_snmp_open_cb, (void *)device_uri, sock, NULL, NULL))
       goto error;
   }
@@ -55,6 +55,9 @@ extern void		_papplDeviceAddNetworkSchemes(void) _PAPPL_PRIVATE;
 extern void		_papplDeviceAddSupportedSchemes(ipp_t *attrs);
 extern void		_papplDeviceAddUSBScheme(void) _PAPPL_PRIVATE;
 extern void		_papplDeviceError(pappl_deverror_cb_t err_cb, void *err_data, const char *message, ...) _PAPPL_FORMAT(3,4) _PAPPL_PRIVATE;
+extern bool		_papplDeviceProbe(const char *device_uri) _PAPPL_PRIVATE;
+extern bool		_papplDeviceProbeNetwork(const char *device_uri) _PAPPL_PRIVATE;
+extern bool		_papplDeviceProbeUSB(const char *device_uri) _PAPPL_PRIVATE;
 
 
 #endif // !_PAPPL_DEVICE_H_
@@ -38,6 +38,40 @@ typedef struct _pappl_usb_dev_s		// USB device data
 			read_endp,		// Read endpoint
 			protocol;		// Protocol: 1 = Uni-di, 2 = Bi-di.
 } _pappl_usb_dev_t;
+
+typedef struct _pappl_usb_cache_s	// USB device topology cache
+{
+  char			*uri,			// Device URI
+			*serial;		// Serial number string, if any
+  uint8_t		bus,			// Bus number
+			ports[8];		// Port numbers
+  int			num_ports;		// Number of port numbers
+  uint16_t		vendor_id,		// Vendor ID
+			product_id;		// Product ID
+  int			conf,			// Configuration
+			iface,			// Interface
+			ifacenum,		// Interface number
+			altset,			// Alternate setting
+			write_endp,		// Write endpoint
+			read_endp,		// Read endpoint
+			protocol;		// Protocol: 1 = Uni-di, 2 = Bi-di.
+} _pappl_usb_cache_t;
+
+
+//
+// Local globals...
+//
+
+static cups_array_t	*usb_cache = NULL;
+					// Known USB printer locations
+static pthread_mutex_t	usb_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+					// Mutex for USB printer locations
+static libusb_hotplug_callback_handle usb_hotplug;
+					// Hotplug callback for USB printer locations
+static bool		usb_hotplug_registered = false;
+					// Is the hotplug callback registered?
+static pthread_mutex_t	usb_hotplug_mutex = PTHREAD_MUTEX_INITIALIZER;
+					// Mutex for hotplug callback registration
 #endif // HAVE_LIBUSB
 
 
@@ -46,6 +80,13 @@ typedef struct _pappl_usb_dev_s		// USB device data
 //
 
 #ifdef HAVE_LIBUSB
+static int		pappl_usb_cache_compare(_pappl_usb_cache_t *a, _pappl_usb_cache_t *b);
+static void		pappl_usb_cache_free(_pappl_usb_cache_t *c);
+static int		pappl_usb_cache_hotplug_cb(libusb_context *ctx, libusb_device *udevice, libusb_hotplug_event event, void *data);
+static bool		pappl_usb_cache_open(const char *device_uri, _pappl_usb_dev_t *device, pappl_deverror_cb_t err_cb, void *err_data);
+static void		pappl_usb_cache_set(const char *device_uri, _pappl_usb_dev_t *device);
+static void		pappl_usb_cache_watch(bool watch);
+static bool		pappl_usb_claim(_pappl_usb_dev_t *device, const struct libusb_config_descriptor *confptr, pappl_deverror_cb_t err_cb, void *err_data);
 static void		pappl_usb_close(pappl_device_t *device);
 static bool		pappl_usb_find(pappl_device_cb_t cb, void *data, _pappl_usb_dev_t *device, pappl_deverror_cb_t err_cb, void *err_data);
 static char		*pappl_usb_getid(pappl_device_t *device, char *buffer, size_t bufsize);
@@ -71,7 +112,525 @@ _papplDeviceAddUSBScheme(void)
 }
 
 
+//
+// '_papplDeviceProbeUSB()' - Quickly check whether a USB printer is present.
+//
+// This function only looks at the cached device and configuration descriptors
+// and does not open any device, so it is much cheaper than a full open.  When
+// the vendor and product IDs for the device URI are known from a previous
+// open, only a device with those IDs matches.  Otherwise any USB printer
+// matches since the URI's make, model, and serial number can only be read from
+// an open device.
+//
+
+bool					// O - `true` if a USB printer is present, `false` otherwise
+_papplDeviceProbeUSB(
+    const char *device_uri)		// I - Device URI
+{
 #ifdef HAVE_LIBUSB
+  bool		found = false;		// Found a printer?
+  ssize_t	i,			// Looping var
+		num_udevs;		// Number of USB devices
+  libusb_device	**udevs;		// USB devices
+  _pappl_usb_cache_t key,		// Search key
+		*c;			// Cached device, if any
+  uint16_t	vendor_id = 0,		// Vendor ID to look for, if any
+		product_id = 0;		// Product ID to look for, if any
+
+
+  // Use the IDs from the last successful open, if any...
+  pthread_mutex_lock(&usb_cache_mutex);
+
+  key.uri = (char *)device_uri;
+
+  if (device_uri && (c = (_pappl_usb_cache_t *)cupsArrayFind(usb_cache, &key)) != NULL)
+  {
+    vendor_id  = c->vendor_id;
+    product_id = c->product_id;
+  }
+
+  pthread_mutex_unlock(&usb_cache_mutex);
+
+  if (libusb_init(NULL))
+    return (false);
+
+  num_udevs = libusb_get_device_list(NULL, &udevs);
+
+  for (i = 0; i < num_udevs && !found; i ++)
+  {
+    struct libusb_device_descriptor devdesc;
+					// Current device descriptor
+    struct libusb_config_descriptor *confptr = NULL;
+					// Pointer to current configuration
+    const struct libusb_interface *ifaceptr;
+					// Pointer to current interface
+    uint8_t	conf,			// Current configuration
+		iface;			// Current interface
+    int		altset;			// Current alternate setting
+
+    if (libusb_get_device_descriptor(udevs[i], &devdesc) < 0 || !devdesc.bNumConfigurations || !devdesc.idVendor || !devdesc.idProduct || devdesc.idVendor == 0x05ac)
+      continue;
+
+    if (vendor_id && (devdesc.idVendor != vendor_id || devdesc.idProduct != product_id))
+      continue;
+
+    for (conf = 0; conf < devdesc.bNumConfigurations && !found; conf ++)
+    {
+      if (libusb_get_config_descriptor(udevs[i], conf, &confptr) < 0)
+        continue;
+
+      for (iface = 0, ifaceptr = confptr->interface; iface < confptr->bNumInterfaces && !found; iface ++, ifaceptr ++)
+      {
+        for (altset = 0; altset < ifaceptr->num_altsetting; altset ++)
+        {
+          if (ifaceptr->altsetting[altset].bInterfaceClass == LIBUSB_CLASS_PRINTER)
+          {
+            found = true;
+            break;
+          }
+        }
+      }
+
+      libusb_free_config_descriptor(confptr);
+    }
+  }
+
+  if (num_udevs > 0)
+    libusb_free_device_list(udevs, 1);
+
+  libusb_exit(NULL);
+
+  return (found);
+
+#else
+  (void)device_uri;
+
+  return (false);
+#endif // HAVE_LIBUSB
+}
+
+
+#ifdef HAVE_LIBUSB
+//
+// 'pappl_usb_cache_compare()' - Compare two USB topology cache entries.
+//
+
+static int				// O - Result of comparison
+pappl_usb_cache_compare(
+    _pappl_usb_cache_t *a,		// I - First entry
+    _pappl_usb_cache_t *b)		// I - Second entry
+{
+  return (strcmp(a->uri, b->uri));
+}
+
+
+//
+// 'pappl_usb_cache_free()' - Free a USB topology cache entry.
+//
+
+static void
+pappl_usb_cache_free(
+    _pappl_usb_cache_t *c)		// I - Cache entry
+{
+  free(c->uri);
+  free(c->serial);
+  free(c);
+}
+
+
+//
+// 'pappl_usb_cache_hotplug_cb()' - Forget cached printers when devices come
+//                                  and go.
+//
+
+static int				// O - 0 to keep the callback registered
+pappl_usb_cache_hotplug_cb(
+    libusb_context       *ctx,		// I - USB context
+    libusb_device        *udevice,	// I - Device that arrived or left
+    libusb_hotplug_event event,		// I - Hotplug event
+    void                 *data)		// I - Callback data (unused)
+{
+  _pappl_usb_cache_t	*c;		// Current cache entry
+  uint8_t		bus,		// Bus number
+			ports[8];	// Port numbers
+  int			num_ports;	// Number of port numbers
+
+
+  (void)ctx;
+  (void)data;
+
+  bus       = libusb_get_bus_number(udevice);
+  num_ports = libusb_get_port_numbers(udevice, ports, (int)sizeof(ports));
+
+  _PAPPL_DEBUG("pappl_usb_cache_hotplug_cb: event=%d, bus=%d, num_ports=%d\n", event, bus, num_ports);
+
+  pthread_mutex_lock(&usb_cache_mutex);
+
+  for (c = (_pappl_usb_cache_t *)cupsArrayGetFirst(usb_cache); c; c = (_pappl_usb_cache_t *)cupsArrayGetNext(usb_cache))
+  {
+    if (c->bus == bus && c->num_ports == num_ports && !memcmp(c->ports, ports, (size_t)num_ports))
+      cupsArrayRemove(usb_cache, c);
+  }
+
+  pthread_mutex_unlock(&usb_cache_mutex);
+
+  return (0);
+}
+
+
+//
+// 'pappl_usb_cache_open()' - Open a USB printer at its last known location.
+//
+// The device at the cached bus and port path must still have the same vendor,
+// product, and serial number, otherwise the cache entry is removed and `false`
+// is returned so the caller can do a full enumeration.
+//
+
+static bool				// O - `true` on success, `false` on failure
+pappl_usb_cache_open(
+    const char          *device_uri,	// I - Device URI
+    _pappl_usb_dev_t    *device,	// O - USB device info
+    pappl_deverror_cb_t err_cb,		// I - Error callback
+    void                *err_data)	// I - Error callback data
+{
+  _pappl_usb_cache_t	key,		// Search key
+			*c,		// Matching entry
+			cached;		// Copy of matching entry
+  char			serial[256];	// Cached serial number
+  struct timeval	tv;		// Timeout for hotplug events
+  ssize_t		i,		// Looping var
+			num_udevs;	// Number of USB devices
+  libusb_device		**udevs,	// USB devices
+			*udevice = NULL;// Matching device
+  struct libusb_device_descriptor devdesc;
+					// Device descriptor
+  struct libusb_config_descriptor *confptr = NULL;
+					// Configuration descriptor
+
+
+  device->device = NULL;
+  device->handle = NULL;
+
+  if (libusb_init(NULL))
+    return (false);
+
+  // Deliver any pending hotplug events so the cache is current...
+  tv.tv_sec  = 0;
+  tv.tv_usec = 0;
+
+  libusb_handle_events_timeout_completed(NULL, &tv, NULL);
+
+  // Look up the last known location...
+  pthread_mutex_lock(&usb_cache_mutex);
+
+  key.uri = (char *)device_uri;
+
+  if ((c = (_pappl_usb_cache_t *)cupsArrayFind(usb_cache, &key)) != NULL)
+  {
+    cached = *c;
+    papplCopyString(serial, c->serial ? c->serial : "", sizeof(serial));
+  }
+
+  pthread_mutex_unlock(&usb_cache_mutex);
+
+  if (!c)
+  {
+    libusb_exit(NULL);
+    return (false);
+  }
+
+  // Find the device at that location...
+  num_udevs = libusb_get_device_list(NULL, &udevs);
+
+  for (i = 0; i < num_udevs && !udevice; i ++)
+  {
+    uint8_t	ports[8];		// Port numbers
+
+    if (libusb_get_bus_number(udevs[i]) == cached.bus && libusb_get_port_numbers(udevs[i], ports, (int)sizeof(ports)) == cached.num_ports && !memcmp(ports, cached.ports, (size_t)cached.num_ports))
+      udevice = udevs[i];
+  }
+
+  if (!udevice || libusb_get_device_descriptor(udevice, &devdesc) < 0 || devdesc.idVendor != cached.vendor_id || devdesc.idProduct != cached.product_id)
+    goto invalid;
+
+  if (libusb_get_config_descriptor(udevice, (uint8_t)cached.conf, &confptr) < 0)
+    goto invalid;
+
+  device->device     = udevice;
+  device->conf       = cached.conf;
+  device->origconf   = -1;
+  device->iface      = cached.iface;
+  device->ifacenum   = cached.ifacenum;
+  device->altset     = cached.altset;
+  device->write_endp = cached.write_endp;
+  device->read_endp  = cached.read_endp;
+  device->protocol   = cached.protocol;
+
+  // Verify the serial number before changing anything on the device, since
+  // a different printer may now be at this location...
+  if (libusb_open(udevice, &device->handle))
+  {
+    device->handle = NULL;
+    goto invalid;
+  }
+
+  if (serial[0])
+  {
+    char	temp[256];		// Current serial number
+    int		length = devdesc.iSerialNumber ? libusb_get_string_descriptor_ascii(device->handle, devdesc.iSerialNumber, (unsigned char *)temp, sizeof(temp) - 1) : 0;
+					// Length of serial number
+
+    if (length < 0)
+      length = 0;
+
+    temp[length] = '\0';
+
+    if (strcmp(serial, temp))
+    {
+      libusb_close(device->handle);
+      device->handle = NULL;
+      goto invalid;
+    }
+  }
+
+  if (!pappl_usb_claim(device, confptr, err_cb, err_data))
+    goto invalid;
+
+  _PAPPL_DEBUG("pappl_usb_cache_open: Reopened '%s' at bus %d.\n", device_uri, cached.bus);
+
+  libusb_ref_device(udevice);
+  libusb_free_config_descriptor(confptr);
+  libusb_free_device_list(udevs, 1);
+
+  return (true);
+
+  // If we get here the cached location is no longer valid...
+  invalid:
+
+  _PAPPL_DEBUG("pappl_usb_cache_open: '%s' is no longer at bus %d.\n", device_uri, cached.bus);
+
+  device->device = NULL;
+
+  if (confptr)
+    libusb_free_config_descriptor(confptr);
+
+  if (num_udevs >= 0)
+    libusb_free_device_list(udevs, 1);
+
+  pthread_mutex_lock(&usb_cache_mutex);
+  if ((c = (_pappl_usb_cache_t *)cupsArrayFind(usb_cache, &key)) != NULL)
+    cupsArrayRemove(usb_cache, c);
+  pthread_mutex_unlock(&usb_cache_mutex);
+
+  pappl_usb_cache_watch(false);
+
+  libusb_exit(NULL);
+
+  return (false);
+}
+
+
+//
+// 'pappl_usb_cache_set()' - Remember the location of an open USB printer.
+//
+
+static void
+pappl_usb_cache_set(
+    const char       *device_uri,	// I - Device URI
+    _pappl_usb_dev_t *device)		// I - USB device info
+{
+  _pappl_usb_cache_t	key,		// Search key
+			*c;		// Cache entry
+  struct libusb_device_descriptor devdesc;
+					// Device descriptor
+  char			serial[256];	// Serial number
+  int			length;		// Length of serial number
+
+
+  if (libusb_get_device_descriptor(device->device, &devdesc) < 0)
+    return;
+
+  if (!devdesc.iSerialNumber || (length = libusb_get_string_descriptor_ascii(device->handle, devdesc.iSerialNumber, (unsigned char *)serial, sizeof(serial) - 1)) < 0)
+    length = 0;
+
+  serial[length] = '\0';
+
+  pthread_mutex_lock(&usb_cache_mutex);
+
+  if (!usb_cache)
+    usb_cache = cupsArrayNew((cups_array_cb_t)pappl_usb_cache_compare, NULL, NULL, 0, NULL, (cups_afree_cb_t)pappl_usb_cache_free);
+
+  key.uri = (char *)device_uri;
+
+  if ((c = (_pappl_usb_cache_t *)cupsArrayFind(usb_cache, &key)) != NULL)
+  {
+    cupsArrayRemove(usb_cache, c);
+  }
+
+  if ((c = (_pappl_usb_cache_t *)calloc(1, sizeof(_pappl_usb_cache_t))) != NULL)
+  {
+    c->uri        = strdup(device_uri);
+    c->serial     = serial[0] ? strdup(serial) : NULL;
+    c->bus        = libusb_get_bus_number(device->device);
+    c->num_ports  = libusb_get_port_numbers(device->device, c->ports, (int)sizeof(c->ports));
+    c->vendor_id  = devdesc.idVendor;
+    c->product_id = devdesc.idProduct;
+    c->conf       = device->conf;
+    c->iface      = device->iface;
+    c->ifacenum   = device->ifacenum;
+    c->altset     = device->altset;
+    c->write_endp = device->write_endp;
+    c->read_endp  = device->read_endp;
+    c->protocol   = device->protocol;
+
+    if (c->num_ports < 0)
+      pappl_usb_cache_free(c);
+    else
+      cupsArrayAdd(usb_cache, c);
+  }
+
+  pthread_mutex_unlock(&usb_cache_mutex);
+
+  // Get notified when devices are added or removed...
+  pappl_usb_cache_watch(true);
+}
+
+
+//
+// 'pappl_usb_cache_watch()' - Start or stop watching for hotplug events.
+//
+// The hotplug callback holds its own libusb reference while registered and is
+// only unregistered once the cache is empty.  Registration happens without
+// holding the cache mutex since libusb holds its own hotplug lock while
+// calling the callback, which in turn locks the cache mutex.
+//
+
+static void
+pappl_usb_cache_watch(bool watch)	// I - `true` to start watching, `false` to stop
+{
+  bool	empty;				// Is the cache empty?
+
+
+  pthread_mutex_lock(&usb_hotplug_mutex);
+
+  if (watch && !usb_hotplug_registered)
+  {
+    if (libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG) && !libusb_init(NULL))
+    {
+      if (libusb_hotplug_register_callback(NULL, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT, LIBUSB_HOTPLUG_NO_FLAGS, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY, pappl_usb_cache_hotplug_cb, NULL, &usb_hotplug) == LIBUSB_SUCCESS)
+        usb_hotplug_registered = true;
+      else
+        libusb_exit(NULL);
+    }
+  }
+  else if (!watch && usb_hotplug_registered)
+  {
+    pthread_mutex_lock(&usb_cache_mutex);
+    empty = cupsArrayGetCount(usb_cache) == 0;
+    pthread_mutex_unlock(&usb_cache_mutex);
+
+    if (empty)
+    {
+      libusb_hotplug_deregister_callback(NULL, usb_hotplug);
+      libusb_exit(NULL);
+
+      usb_hotplug_registered = false;
+    }
+  }
+
+  pthread_mutex_unlock(&usb_hotplug_mutex);
+}
+
+
+//
+// 'pappl_usb_claim()' - Open a USB device and claim the printer interface.
+//
+// If the device is already open, the existing handle is used.
+//
+
+static bool				// O - `true` on success, `false` on error
+pappl_usb_claim(
+    _pappl_usb_dev_t                      *device,
+					// I - USB device info
+    const struct libusb_config_descriptor *confptr,
+					// I - Configuration descriptor
+    pappl_deverror_cb_t                   err_cb,
+					// I - Error callback
+    void                                  *err_data)
+					// I - Error callback data
+{
+  int		err;			// Current error
+  uint8_t	current;		// Current configuration
+
+
+  if (!device->handle && libusb_open(device->device, &device->handle))
+  {
+    device->handle = NULL;
+    return (false);
+  }
+
+  // Opened the device, try to set the configuration...
+  if (libusb_control_transfer(device->handle, LIBUSB_REQUEST_TYPE_STANDARD | LIBUSB_ENDPOINT_IN | LIBUSB_RECIPIENT_DEVICE, 8, /* GET_CONFIGURATION */ 0, 0, (unsigned char *)&current, 1, 5000) < 0)
+    current = 0;
+
+  if (confptr->bConfigurationValue != current)
+  {
+    // Select the configuration we want...
+    if (libusb_set_configuration(device->handle, confptr->bConfigurationValue) < 0)
+    {
+      libusb_close(device->handle);
+      device->handle = NULL;
+    }
+  }
+
+#ifdef __linux
+  if (device->handle)
+  {
+    // Make sure the old, busted usblp kernel driver is not loaded...
+    if (libusb_kernel_driver_active(device->handle, device->iface) == 1)
+    {
+      if ((err = libusb_detach_kernel_driver(device->handle, device->iface)) < 0 && err != LIBUSB_ERROR_NOT_FOUND)
+      {
+	struct libusb_device_descriptor devdesc;
+					// Device descriptor
+
+        if (libusb_get_device_descriptor(device->device, &devdesc) < 0)
+          memset(&devdesc, 0, sizeof(devdesc));
+
+	_papplDeviceError(err_cb, err_data, "Unable to detach usblp kernel driver for USB printer %04x:%04x: %s", devdesc.idVendor, devdesc.idProduct, libusb_strerror((enum libusb_error)err));
+	libusb_close(device->handle);
+	device->handle = NULL;
+      }
+    }
+  }
+#endif // __linux
+
+  if (device->handle)
+  {
+    // Claim the interface...
+    if ((err = libusb_claim_interface(device->handle, device->ifacenum)) < 0)
+    {
+      _papplDeviceError(err_cb, err_data, "Unable to claim USB interface: %s", libusb_strerror((enum libusb_error)err));
+      libusb_close(device->handle);
+      device->handle = NULL;
+    }
+  }
+
+  if (device->handle && confptr->interface[device->iface].num_altsetting > 1)
+  {
+    // Set the alternate setting as needed...
+    if ((err = libusb_set_interface_alt_setting(device->handle, device->ifacenum, device->altset)) < 0)
+    {
+      _papplDeviceError(err_cb, err_data, "Unable to set alternate USB interface: %s", libusb_strerror((enum libusb_error)err));
+      libusb_close(device->handle);
+      device->handle = NULL;
+    }
+  }
+
+  return (device->handle != NULL);
+}
+
+
 //
 // 'pappl_usb_close()' - Close a USB device.
 //
@@ -274,62 +833,8 @@ pappl_usb_find(
 	  device->conf  = conf;
 	  device->iface = iface;
 
-	  if (!libusb_open(udevice, &device->handle))
+	  if (pappl_usb_claim(device, confptr, err_cb, err_data))
 	  {
-	    uint8_t	current;	// Current configuration
-
-	    // Opened the device, try to set the configuration...
-	    if (libusb_control_transfer(device->handle, LIBUSB_REQUEST_TYPE_STANDARD | LIBUSB_ENDPOINT_IN | LIBUSB_RECIPIENT_DEVICE, 8, /* GET_CONFIGURATION */ 0, 0, (unsigned char *)&current, 1, 5000) < 0)
-	      current = 0;
-
-            if (confptr->bConfigurationValue != current)
-            {
-              // Select the configuration we want...
-              if (libusb_set_configuration(device->handle, confptr->bConfigurationValue) < 0)
-              {
-                libusb_close(device->handle);
-                device->handle = NULL;
-              }
-            }
-
-#ifdef __linux
-            if (device->handle)
-            {
-	      // Make sure the old, busted usblp kernel driver is not loaded...
-	      if (libusb_kernel_driver_active(device->handle, device->iface) == 1)
-	      {
-		if ((err = libusb_detach_kernel_driver(device->handle, device->iface)) < 0 && err != LIBUSB_ERROR_NOT_FOUND)
-		{
-		  _papplDeviceError(err_cb, err_data, "Unable to detach usblp kernel driver for USB printer %04x:%04x: %s", devdesc.idVendor, devdesc.idProduct, libusb_strerror((enum libusb_error)err));
-		  libusb_close(device->handle);
-		  device->handle = NULL;
-		}
-	      }
-	    }
-#endif // __linux
-
-            if (device->handle)
-            {
-              // Claim the interface...
-              if ((err = libusb_claim_interface(device->handle, device->ifacenum)) < 0)
-              {
-		_papplDeviceError(err_cb, err_data, "Unable to claim USB interface: %s", libusb_strerror((enum libusb_error)err));
-                libusb_close(device->handle);
-                device->handle = NULL;
-              }
-            }
-
-            if (device->handle && ifaceptr->num_altsetting > 1)
-            {
-              // Set the alternate setting as needed...
-              if ((err = libusb_set_interface_alt_setting(device->handle, device->ifacenum, device->altset)) < 0)
-              {
-		_papplDeviceError(err_cb, err_data, "Unable to set alternate USB interface: %s", libusb_strerror((enum libusb_error)err));
-                libusb_close(device->handle);
-                device->handle = NULL;
-              }
-            }
-
             if (device->handle)
             {
               // Get the 1284 Device ID...
@@ -555,10 +1060,17 @@ pappl_usb_open(
     return (false);
   }
 
-  if (!pappl_usb_find(pappl_usb_open_cb, (void *)device_uri, usb, device->error_cb, device->error_data))
+  // Try the last known location of the printer before enumerating every USB
+  // device...
+  if (!pappl_usb_cache_open(device_uri, usb, device->error_cb, device->error_data))
   {
-    free(usb);
-    return (false);
+    if (!pappl_usb_find(pappl_usb_open_cb, (void *)device_uri, usb, device->error_cb, device->error_data))
+    {
+      free(usb);
+      return (false);
+    }
+
+    pappl_usb_cache_set(device_uri, usb);
   }
 
   papplDeviceSetData(device, usb);
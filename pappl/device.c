@@ -773,6 +773,37 @@ papplDeviceParseID(
 }
 
 
+//
+// '_papplDeviceProbe()' - Quickly check whether a device is reachable.
+//
+// This function does a cheap reachability check before a full open: a TCP
+// connect for network devices and a descriptor scan for USB devices.  Devices
+// using other URI schemes are always reported as reachable.
+//
+
+bool					// O - `true` if reachable, `false` otherwise
+_papplDeviceProbe(
+    const char *device_uri)		// I - Device URI
+{
+  char		scheme[32];		// URI scheme
+  const char	*sep;			// Pointer to scheme separator
+
+
+  if (!device_uri || (sep = strchr(device_uri, ':')) == NULL || (size_t)(sep - device_uri) >= sizeof(scheme))
+    return (false);
+
+  memcpy(scheme, device_uri, (size_t)(sep - device_uri));
+  scheme[sep - device_uri] = '\0';
+
+  if (!strcmp(scheme, "usb"))
+    return (_papplDeviceProbeUSB(device_uri));
+  else if (!strcmp(scheme, "dnssd") || !strcmp(scheme, "socket"))
+    return (_papplDeviceProbeNetwork(device_uri));
+  else
+    return (true);
+}
+
+
 //
 // 'papplDevicePrintf()' - Write a formatted string.
 //
@@ -324,9 +324,16 @@ _papplPrinterRegisterDNSSDNoLock(
   char			product[248];	// Make and model (legacy)
   int			max_width;	// Maximum media width (legacy)
   const char		*papermax;	// PaperMax string value (legacy)
+  bool			pdl;		// Register a PDL datastream service?
+  char			keydata[2048],	// Registration key data
+			key[65];	// Registration key
+  unsigned char		keysum[32];	// SHA2-256 sum of key data
+  bool			update;		// Update TXT records in place?
 #  ifdef HAVE_MDNSRESPONDER
+  _pappl_txt_t		pdl_txt;	// DNS-SD TXT record for PDL datastream
   DNSServiceErrorType	error;		// Error from mDNSResponder
 #  else
+  AvahiStringList	*pdl_txt = NULL;// DNS-SD TXT record for PDL datastream
   int			error;		// Error from Avahi
   char			fullname[256];	// Full service name
 #  endif // HAVE_MDNSRESPONDER
@@ -381,7 +388,7 @@ _papplPrinterRegisterDNSSDNoLock(
 
   for (i = 0, max_width = 0; i < (cups_len_t)printer->driver_data.num_media; i ++)
   {
-    pwg_media_t *media = pwgMediaForPWG(printer->driver_data.media[i]);
+    pwg_media_t *media = _papplPrinterFindMedia(printer, printer->driver_data.media[i]);
 					// Current media size
 
     if (media && media->width > max_width)
@@ -466,6 +473,27 @@ _papplPrinterRegisterDNSSDNoLock(
 
   if ((master = _papplDNSSDInit(printer->system)) == NULL)
     return (false);
+
+  // Build the registration key from everything other than the TXT records that
+  // affects the registered services - if it matches the current registration,
+  // only the TXT records (and location) need to be updated, which keeps the
+  // registration alive and avoids a goodbye/announce cycle on the network...
+  pdl = (system->options & PAPPL_SOPTIONS_RAW_SOCKET) && printer->num_raw_listeners > 0;
+
+#  ifdef HAVE_MDNSRESPONDER
+  // LOC records can be updated in place, so only track their presence...
+  snprintf(keydata, sizeof(keydata), "%s|%s|%d|%s|%s|%d|%d|%d", printer->dns_sd_name, system->hostname, system->port, system->subtypes ? system->subtypes : "", printer->uriname, !(system->options & PAPPL_SOPTIONS_NO_TLS), pdl ? 9099 + printer->printer_id : 0, printer->geo_location != NULL);
+  update = printer->dns_sd_ipp_ref != NULL;
+#  else
+  // Avahi can only update TXT records in place, so track the location too...
+  snprintf(keydata, sizeof(keydata), "%s|%s|%d|%s|%s|%d|%d|%s", printer->dns_sd_name, system->hostname, system->port, system->subtypes ? system->subtypes : "", printer->uriname, !(system->options & PAPPL_SOPTIONS_NO_TLS), pdl ? 9099 + printer->printer_id : 0, printer->geo_location ? printer->geo_location : "");
+  update = printer->dns_sd_ref != NULL;
+#  endif // HAVE_MDNSRESPONDER
+
+  cupsHashData("sha2-256", keydata, strlen(keydata), keysum, sizeof(keysum));
+  cupsHashString(keysum, sizeof(keysum), key, sizeof(key));
+
+  update = update && !strcmp(key, printer->dns_sd_key);
 #endif // HAVE_DNSSD
 
 #ifdef HAVE_MDNSRESPONDER
@@ -500,6 +528,87 @@ _papplPrinterRegisterDNSSDNoLock(
   TXTRecordSetValue(&txt, "PaperMax", (uint8_t)strlen(papermax), papermax);
   TXTRecordSetValue(&txt, "Scan", 1, "F");
 
+  if (pdl)
+  {
+    // Build the TXT record for the PDL datastream (raw socket) service...
+    TXTRecordCreate(&pdl_txt, 1024, NULL);
+    if (printer->driver_data.make_and_model[0])
+      TXTRecordSetValue(&pdl_txt, "ty", (uint8_t)strlen(printer->driver_data.make_and_model), printer->driver_data.make_and_model);
+    TXTRecordSetValue(&pdl_txt, "adminurl", (uint8_t)strlen(adminurl), adminurl);
+    if (printer->location)
+      TXTRecordSetValue(&pdl_txt, "note", (uint8_t)strlen(printer->location), printer->location);
+    else
+      TXTRecordSetValue(&pdl_txt, "note", 0, "");
+    TXTRecordSetValue(&pdl_txt, "pdl", (uint8_t)strlen(formats), formats);
+    if ((value = ippGetString(printer_uuid, 0, NULL)) != NULL)
+      TXTRecordSetValue(&pdl_txt, "UUID", (uint8_t)strlen(value) - 9, value + 9);
+    TXTRecordSetValue(&pdl_txt, "Color", 1, ippGetBoolean(color_supported, 0) ? "T" : "F");
+    TXTRecordSetValue(&pdl_txt, "Duplex", 1, (printer->driver_data.sides_supported & PAPPL_SIDES_TWO_SIDED_LONG_EDGE) ? "T" : "F");
+    TXTRecordSetValue(&pdl_txt, "txtvers", 1, "1");
+    TXTRecordSetValue(&pdl_txt, "qtotal", 1, "1");
+    TXTRecordSetValue(&pdl_txt, "priority", 3, "100");
+
+    // Legacy keys...
+    TXTRecordSetValue(&pdl_txt, "product", (uint8_t)strlen(product), product);
+    TXTRecordSetValue(&pdl_txt, "Fax", 1, "F");
+    TXTRecordSetValue(&pdl_txt, "PaperMax", (uint8_t)strlen(papermax), papermax);
+    TXTRecordSetValue(&pdl_txt, "Scan", 1, "F");
+  }
+
+  if (update)
+  {
+    // Only the TXT records and location have changed, update them in place...
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Updating DNS-SD TXT records for '%s'.", printer->dns_sd_name);
+
+    if ((error = DNSServiceUpdateRecord(printer->dns_sd_ipp_ref, NULL, 0, TXTRecordGetLength(&txt), TXTRecordGetBytesPtr(&txt), 0)) != kDNSServiceErr_NoError)
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update TXT record for '%s._ipp._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+      ret = false;
+    }
+
+    if (printer->dns_sd_ipp_loc_ref && (error = DNSServiceUpdateRecord(printer->dns_sd_ipp_ref, printer->dns_sd_ipp_loc_ref, 0, sizeof(printer->dns_sd_loc), printer->dns_sd_loc, 0)) != kDNSServiceErr_NoError)
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update LOC record for '%s._ipp._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+      ret = false;
+    }
+
+    if (printer->dns_sd_ipps_ref)
+    {
+      if ((error = DNSServiceUpdateRecord(printer->dns_sd_ipps_ref, NULL, 0, TXTRecordGetLength(&txt), TXTRecordGetBytesPtr(&txt), 0)) != kDNSServiceErr_NoError)
+      {
+	papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update TXT record for '%s._ipps._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+	ret = false;
+      }
+
+      if (printer->dns_sd_ipps_loc_ref && (error = DNSServiceUpdateRecord(printer->dns_sd_ipps_ref, printer->dns_sd_ipps_loc_ref, 0, sizeof(printer->dns_sd_loc), printer->dns_sd_loc, 0)) != kDNSServiceErr_NoError)
+      {
+	papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update LOC record for '%s._ipps._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+	ret = false;
+      }
+    }
+
+    TXTRecordDeallocate(&txt);
+
+    if (pdl)
+    {
+      if (printer->dns_sd_pdl_ref && (error = DNSServiceUpdateRecord(printer->dns_sd_pdl_ref, NULL, 0, TXTRecordGetLength(&pdl_txt), TXTRecordGetBytesPtr(&pdl_txt), 0)) != kDNSServiceErr_NoError)
+      {
+	papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update TXT record for '%s._pdl-datastream._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+	ret = false;
+      }
+
+      TXTRecordDeallocate(&pdl_txt);
+    }
+
+    if (ret)
+      return (true);
+
+    // Fall back to a full registration...
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Re-registering DNS-SD services for '%s'.", printer->dns_sd_name);
+    printer->dns_sd_key[0] = '\0';
+    return (_papplPrinterRegisterDNSSDNoLock(printer));
+  }
+
   // Register the _printer._tcp (LPD) service type with a port number of 0 to
   // defend our service name but not actually support LPD...
   if (printer->dns_sd_printer_ref)
@@ -572,44 +681,21 @@ _papplPrinterRegisterDNSSDNoLock(
 
   TXTRecordDeallocate(&txt);
 
-  if ((system->options & PAPPL_SOPTIONS_RAW_SOCKET) && printer->num_raw_listeners > 0)
+  if (pdl)
   {
     // Register a PDL datastream (raw socket) service...
-    TXTRecordCreate(&txt, 1024, NULL);
-    if (printer->driver_data.make_and_model[0])
-      TXTRecordSetValue(&txt, "ty", (uint8_t)strlen(printer->driver_data.make_and_model), printer->driver_data.make_and_model);
-    TXTRecordSetValue(&txt, "adminurl", (uint8_t)strlen(adminurl), adminurl);
-    if (printer->location)
-      TXTRecordSetValue(&txt, "note", (uint8_t)strlen(printer->location), printer->location);
-    else
-      TXTRecordSetValue(&txt, "note", 0, "");
-    TXTRecordSetValue(&txt, "pdl", (uint8_t)strlen(formats), formats);
-    if ((value = ippGetString(printer_uuid, 0, NULL)) != NULL)
-      TXTRecordSetValue(&txt, "UUID", (uint8_t)strlen(value) - 9, value + 9);
-    TXTRecordSetValue(&txt, "Color", 1, ippGetBoolean(color_supported, 0) ? "T" : "F");
-    TXTRecordSetValue(&txt, "Duplex", 1, (printer->driver_data.sides_supported & PAPPL_SIDES_TWO_SIDED_LONG_EDGE) ? "T" : "F");
-    TXTRecordSetValue(&txt, "txtvers", 1, "1");
-    TXTRecordSetValue(&txt, "qtotal", 1, "1");
-    TXTRecordSetValue(&txt, "priority", 3, "100");
-
-    // Legacy keys...
-    TXTRecordSetValue(&txt, "product", (uint8_t)strlen(product), product);
-    TXTRecordSetValue(&txt, "Fax", 1, "F");
-    TXTRecordSetValue(&txt, "PaperMax", (uint8_t)strlen(papermax), papermax);
-    TXTRecordSetValue(&txt, "Scan", 1, "F");
-
     if (printer->dns_sd_pdl_ref)
       DNSServiceRefDeallocate(printer->dns_sd_pdl_ref);
 
     printer->dns_sd_pdl_ref = master;
 
-    if ((error = DNSServiceRegister(&printer->dns_sd_pdl_ref, kDNSServiceFlagsShareConnection | kDNSServiceFlagsNoAutoRename, 0 /* interfaceIndex */, printer->dns_sd_name, "_pdl-datastream._tcp", NULL /* domain */, system->hostname, htons(9099 + printer->printer_id), TXTRecordGetLength(&txt), TXTRecordGetBytesPtr(&txt), (DNSServiceRegisterReply)dns_sd_printer_callback, printer)) != kDNSServiceErr_NoError)
+    if ((error = DNSServiceRegister(&printer->dns_sd_pdl_ref, kDNSServiceFlagsShareConnection | kDNSServiceFlagsNoAutoRename, 0 /* interfaceIndex */, printer->dns_sd_name, "_pdl-datastream._tcp", NULL /* domain */, system->hostname, htons(9099 + printer->printer_id), TXTRecordGetLength(&pdl_txt), TXTRecordGetBytesPtr(&pdl_txt), (DNSServiceRegisterReply)dns_sd_printer_callback, printer)) != kDNSServiceErr_NoError)
     {
       papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to register '%s.%s': %s", printer->dns_sd_name, "_pdl-datastream._tcp", _papplDNSSDStrError(error));
       ret = false;
     }
 
-    TXTRecordDeallocate(&txt);
+    TXTRecordDeallocate(&pdl_txt);
   }
 
   // Register the _http._tcp,_printer (HTTP) service type with the real port
@@ -661,9 +747,70 @@ _papplPrinterRegisterDNSSDNoLock(
   txt = avahi_string_list_add_printf(txt, "PaperMax=%s", papermax);
   txt = avahi_string_list_add_printf(txt, "Scan=F");
 
-  // Register _printer._tcp (LPD) with port 0 to reserve the service name...
+  if (pdl)
+  {
+    // Create the TXT record for the PDL datastream (raw socket) service...
+    if (printer->driver_data.make_and_model[0])
+      pdl_txt = avahi_string_list_add_printf(pdl_txt, "ty=%s", printer->driver_data.make_and_model);
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "adminurl=%s", adminurl);
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "note=%s", printer->location ? printer->location : "");
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "pdl=%s", formats);
+    if ((value = ippGetString(printer_uuid, 0, NULL)) != NULL)
+      pdl_txt = avahi_string_list_add_printf(pdl_txt, "UUID=%s", value + 9);
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "Color=%s", ippGetBoolean(color_supported, 0) ? "T" : "F");
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "Duplex=%s", (printer->driver_data.sides_supported & PAPPL_SIDES_TWO_SIDED_LONG_EDGE) ? "T" : "F");
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "txtvers=1");
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "qtotal=1");
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "priority=100");
+
+    // Legacy keys...
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "product=%s", product);
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "Fax=F");
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "PaperMax=%s", papermax);
+    pdl_txt = avahi_string_list_add_printf(pdl_txt, "Scan=F");
+  }
+
   _papplDNSSDLock();
 
+  if (update)
+  {
+    // Only the TXT records have changed, update them in place...
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Updating DNS-SD TXT records for '%s'.", printer->dns_sd_name);
+
+    if ((error = avahi_entry_group_update_service_txt_strlst(printer->dns_sd_ref, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, 0, printer->dns_sd_name, "_ipp._tcp", NULL, txt)) < 0)
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update TXT record for '%s._ipp._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+      ret = false;
+    }
+
+    if (!(printer->system->options & PAPPL_SOPTIONS_NO_TLS) && (error = avahi_entry_group_update_service_txt_strlst(printer->dns_sd_ref, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, 0, printer->dns_sd_name, "_ipps._tcp", NULL, txt)) < 0)
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update TXT record for '%s._ipps._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+      ret = false;
+    }
+
+    if (pdl && (error = avahi_entry_group_update_service_txt_strlst(printer->dns_sd_ref, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, 0, printer->dns_sd_name, "_pdl-datastream._tcp", NULL, pdl_txt)) < 0)
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to update TXT record for '%s._pdl-datastream._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
+      ret = false;
+    }
+
+    _papplDNSSDUnlock();
+
+    avahi_string_list_free(txt);
+    avahi_string_list_free(pdl_txt);
+
+    if (ret)
+      return (true);
+
+    // Fall back to a full registration...
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Re-registering DNS-SD services for '%s'.", printer->dns_sd_name);
+    printer->dns_sd_key[0] = '\0';
+    return (_papplPrinterRegisterDNSSDNoLock(printer));
+  }
+
+  // Register _printer._tcp (LPD) with port 0 to reserve the service name...
+
   if (printer->dns_sd_ref)
     avahi_entry_group_free(printer->dns_sd_ref);
 
@@ -672,6 +819,7 @@ _papplPrinterRegisterDNSSDNoLock(
     papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to register printer, is the Avahi daemon running?");
     _papplDNSSDUnlock();
     avahi_string_list_free(txt);
+    avahi_string_list_free(pdl_txt);
     return (false);
   }
 
@@ -745,38 +893,18 @@ _papplPrinterRegisterDNSSDNoLock(
 
   avahi_string_list_free(txt);
 
-  if ((system->options & PAPPL_SOPTIONS_RAW_SOCKET) && printer->num_raw_listeners > 0)
+  if (pdl)
   {
     // Register a PDL datastream (raw socket) service...
-    txt = NULL;
-    if (printer->driver_data.make_and_model[0])
-      txt = avahi_string_list_add_printf(txt, "ty=%s", printer->driver_data.make_and_model);
-    txt = avahi_string_list_add_printf(txt, "adminurl=%s", adminurl);
-    txt = avahi_string_list_add_printf(txt, "note=%s", printer->location ? printer->location : "");
-    txt = avahi_string_list_add_printf(txt, "pdl=%s", formats);
-    if ((value = ippGetString(printer_uuid, 0, NULL)) != NULL)
-      txt = avahi_string_list_add_printf(txt, "UUID=%s", value + 9);
-    txt = avahi_string_list_add_printf(txt, "Color=%s", ippGetBoolean(color_supported, 0) ? "T" : "F");
-    txt = avahi_string_list_add_printf(txt, "Duplex=%s", (printer->driver_data.sides_supported & PAPPL_SIDES_TWO_SIDED_LONG_EDGE) ? "T" : "F");
-    txt = avahi_string_list_add_printf(txt, "txtvers=1");
-    txt = avahi_string_list_add_printf(txt, "qtotal=1");
-    txt = avahi_string_list_add_printf(txt, "priority=100");
-
-    // Legacy keys...
-    txt = avahi_string_list_add_printf(txt, "product=%s", product);
-    txt = avahi_string_list_add_printf(txt, "Fax=F");
-    txt = avahi_string_list_add_printf(txt, "PaperMax=%s", papermax);
-    txt = avahi_string_list_add_printf(txt, "Scan=F");
-
-    if ((error = avahi_entry_group_add_service_strlst(printer->dns_sd_ref, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, 0, printer->dns_sd_name, "_pdl-datastream._tcp", NULL, system->hostname, 9099 + printer->printer_id, txt)) < 0)
+    if ((error = avahi_entry_group_add_service_strlst(printer->dns_sd_ref, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, 0, printer->dns_sd_name, "_pdl-datastream._tcp", NULL, system->hostname, 9099 + printer->printer_id, pdl_txt)) < 0)
     {
       papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to register '%s._pdl-datastream._tcp': %s", printer->dns_sd_name, _papplDNSSDStrError(error));
       ret = false;
     }
-
-    avahi_string_list_free(txt);
   }
 
+  avahi_string_list_free(pdl_txt);
+
   // Register the geolocation of the service...
   if (printer->geo_location && ret)
   {
@@ -811,6 +939,15 @@ _papplPrinterRegisterDNSSDNoLock(
   _papplDNSSDUnlock();
 #endif // HAVE_MDNSRESPONDER
 
+#ifdef HAVE_DNSSD
+  // Remember what was registered so later TXT-only changes can be applied in
+  // place...
+  if (ret)
+    papplCopyString(printer->dns_sd_key, key, sizeof(printer->dns_sd_key));
+  else
+    printer->dns_sd_key[0] = '\0';
+#endif // HAVE_DNSSD
+
   return (ret);
 }
 
@@ -846,6 +983,13 @@ _papplPrinterUnregisterDNSSDNoLock(
     DNSServiceRefDeallocate(printer->dns_sd_http_ref);
     printer->dns_sd_http_ref = NULL;
   }
+  if (printer->dns_sd_pdl_ref)
+  {
+    DNSServiceRefDeallocate(printer->dns_sd_pdl_ref);
+    printer->dns_sd_pdl_ref = NULL;
+  }
+
+  printer->dns_sd_key[0] = '\0';
 
 #elif defined(HAVE_AVAHI)
   _papplDNSSDLock();
@@ -856,6 +1000,8 @@ _papplPrinterUnregisterDNSSDNoLock(
     printer->dns_sd_ref = NULL;
   }
 
+  printer->dns_sd_key[0] = '\0';
+
   _papplDNSSDUnlock();
 
 #else
@@ -69,6 +69,25 @@ papplJobGetAttribute(pappl_job_t *job,	// I - Job
 }
 
 
+//
+// 'papplJobGetCurrentImpression()' - Get the impression (side) currently being
+//                                    printed.
+//
+// This function returns the number of the impression that is currently being
+// printed, starting at `1`, or `0` if the job is not printing.  An impression
+// is one side of an output page.
+//
+// @since PAPPL 1.3@
+//
+
+int					// O - Current impression or `0` if none
+papplJobGetCurrentImpression(
+    pappl_job_t *job)			// I - Job
+{
+  return (job ? _PAPPL_ATOMIC_GET(&job->impcurrent) : 0);
+}
+
+
 //
 // 'papplJobGetData()' - Get per-job driver data.
 //
@@ -89,6 +108,10 @@ papplJobGetData(pappl_job_t *job)	// I - Job
 //
 // This function returns the filename for the job's document data.
 //
+// > Note: The document data of preserved jobs may be compressed with gzip once
+// > the job has finished processing.  Compressed files use a ".gz" extension
+// > and can be read transparently using the CUPS file API (`cupsFileOpen`).
+//
 
 const char *				// O - Filename or `NULL` if none
 papplJobGetFilename(pappl_job_t *job)	// I - Job
@@ -149,7 +172,7 @@ int					// O - Number of completed impressions in job
 papplJobGetImpressionsCompleted(
     pappl_job_t *job)			// I - Job
 {
-  return (job ? job->impcompleted : 0);
+  return (job ? _PAPPL_ATOMIC_GET(&job->impcompleted) : 0);
 }
 
 
@@ -355,7 +378,8 @@ papplJobSetImpressions(
 //                                       the job.
 //
 // This function updates the number of completed impressions in a job.  An
-// impression is one side of an output page.
+// impression is one side of an output page.  The count is updated atomically
+// without locking the job, so it is safe to call for every page.
 //
 
 
@@ -365,11 +389,7 @@ papplJobSetImpressionsCompleted(
     int         add)			// I - Number of impressions/sides to add
 {
   if (job)
-  {
-    pthread_rwlock_wrlock(&job->rwlock);
-    job->impcompleted += add;
-    pthread_rwlock_unlock(&job->rwlock);
-  }
+    _PAPPL_ATOMIC_ADD(&job->impcompleted, add);
 }
 
 
@@ -399,6 +419,7 @@ papplJobSetMessage(pappl_job_t *job,	// I - Job
     pthread_rwlock_wrlock(&job->rwlock);
     free(job->message);
     job->message = strdup(buffer);
+    _papplJobUpdateMemory(job);
     pthread_rwlock_unlock(&job->rwlock);
   }
 }
@@ -356,6 +356,8 @@ papplJobFilterImage(
   // Print every copy...
   for (i = 0; i < options->copies; i ++)
   {
+    _PAPPL_ATOMIC_SET(&job->impcurrent, papplJobGetImpressionsCompleted(job) + 1);
+
     if (!(driver_data.rstartpage_cb)(job, options, device, 1))
     {
       papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to start raster page.");
@@ -604,6 +606,9 @@ _papplJobFilterJPEG(
   _pappl_jpeg_err_t	jerr;		// Error handler info
   unsigned char		*pixels = NULL;	// Image pixels
   JSAMPROW		row;		// Sample row pointer
+  long			pos,		// Current file position
+			consumed = 0;	// Bytes of JPEG data consumed
+  size_t		ripmem = 0;	// Bytes recorded for image pixels
   bool			ret = false;	// Return value
 
 
@@ -657,6 +662,13 @@ _papplJobFilterJPEG(
 
   papplLogJob(job, PAPPL_LOGLEVEL_INFO, "Loading %dx%dx%d JPEG image.", dinfo.output_width, dinfo.output_height, dinfo.output_components);
 
+  if ((size_t)dinfo.output_width * (size_t)dinfo.output_height > _PAPPL_MAX_IMAGE_PIXELS)
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "JPEG image is too large to print.");
+    papplJobSetReasons(job, PAPPL_JREASON_DOCUMENT_UNPRINTABLE_ERROR, PAPPL_JREASON_NONE);
+    goto finish_jpeg;
+  }
+
   if ((pixels = (unsigned char *)malloc((size_t)(dinfo.output_width * dinfo.output_height * (unsigned)dinfo.output_components))) == NULL)
   {
     papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for %dx%dx%d JPEG image.", dinfo.output_width, dinfo.output_height, dinfo.output_components);
@@ -670,6 +682,13 @@ _papplJobFilterJPEG(
   {
     row = (JSAMPROW)(pixels + (size_t)dinfo.output_scanline * (size_t)dinfo.output_width * (size_t)dinfo.output_components);
     jpeg_read_scanlines(&dinfo, &row, 1);
+
+    // Report JPEG data as the decompressor consumes it...
+    if ((pos = ftell(fp)) > consumed)
+    {
+      _papplJobAddBytesProcessed(job, (size_t)(pos - consumed));
+      consumed = pos;
+    }
   }
 
   if (dinfo.X_density != dinfo.Y_density)
@@ -694,8 +713,14 @@ _papplJobFilterJPEG(
     }
   }
 
+  // Note: Only account for the image pixels after decompression since errors
+  // during decompression longjmp past any cleanup...
+  _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_RIP, &ripmem, (size_t)(dinfo.output_width * dinfo.output_height * (unsigned)dinfo.output_components));
+
   ret = papplJobFilterImage(job, device, options, pixels, (int)dinfo.output_width, (int)dinfo.output_height, dinfo.output_components, ppi, true);
 
+  _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_RIP, &ripmem, 0);
+
   jpeg_finish_decompress(&dinfo);
 
   finish_jpeg:
@@ -726,6 +751,8 @@ _papplJobFilterPNG(
   png_color		bg;		// Background color
   int			png_bpp;	// Bytes per pixel
   unsigned char		*pixels = NULL;	// Image pixels
+  struct stat		fileinfo;	// PNG file information
+  size_t		ripmem = 0;	// Bytes recorded for image pixels
   bool			ret = false;	// Return value
 
 
@@ -748,6 +775,13 @@ _papplJobFilterPNG(
 
   papplLogJob(job, PAPPL_LOGLEVEL_INFO, "PNG image is %ux%u", png.width, png.height);
 
+  if ((size_t)png.width * (size_t)png.height > _PAPPL_MAX_IMAGE_PIXELS)
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "PNG image is too large to print.");
+    papplJobSetReasons(job, PAPPL_JREASON_DOCUMENT_UNPRINTABLE_ERROR, PAPPL_JREASON_NONE);
+    goto finish_job;
+  }
+
   // Prepare options...
   options = papplJobCreatePrintOptions(job, 1, (png.format & PNG_FORMAT_FLAG_COLOR) != 0);
 
@@ -764,6 +798,9 @@ _papplJobFilterPNG(
 
   pixels = malloc(PNG_IMAGE_SIZE(png));
 
+  if (pixels)
+    _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_RIP, &ripmem, PNG_IMAGE_SIZE(png));
+
   png_image_finish_read(&png, &bg, pixels, 0, NULL);
 
   if (png.warning_or_error & PNG_IMAGE_ERROR)
@@ -773,6 +810,10 @@ _papplJobFilterPNG(
     goto finish_job;
   }
 
+  // The whole PNG file has been consumed...
+  if (!stat(job->filename, &fileinfo))
+    _papplJobAddBytesProcessed(job, (size_t)fileinfo.st_size);
+
   // TODO: Get PNG image resolution information (Issue #65)
 
   // Print the image...
@@ -786,6 +827,8 @@ _papplJobFilterPNG(
   png_image_free(&png);
   free(pixels);
 
+  _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_RIP, &ripmem, 0);
+
   return (ret);
 }
 #endif // HAVE_LIBPNG
@@ -31,10 +31,12 @@ typedef struct _pappl_attr_s		// Input attribute structure
 // Local functions...
 //
 
+static const char	*detect_format(const unsigned char *header, size_t headersize);
 static void		ipp_cancel_job(pappl_client_t *client);
 static void		ipp_close_job(pappl_client_t *client);
 static void		ipp_get_job_attributes(pappl_client_t *client);
 static void		ipp_send_document(pappl_client_t *client);
+static bool		preflight_document(pappl_client_t *client, const char *format, const unsigned char *header, size_t headersize);
 
 
 //
@@ -72,7 +74,10 @@ _papplJobCopyAttributes(
     ippAddInteger(client->response, IPP_TAG_JOB, IPP_TAG_INTEGER, "job-impressions", job->impressions);
 
   if (!ra || cupsArrayFind(ra, "job-impressions-completed"))
-    ippAddInteger(client->response, IPP_TAG_JOB, IPP_TAG_INTEGER, "job-impressions-completed", job->impcompleted);
+    ippAddInteger(client->response, IPP_TAG_JOB, IPP_TAG_INTEGER, "job-impressions-completed", _PAPPL_ATOMIC_GET(&job->impcompleted));
+
+  if (!ra || cupsArrayFind(ra, "job-k-octets-processed"))
+    ippAddInteger(client->response, IPP_TAG_JOB, IPP_TAG_INTEGER, "job-k-octets-processed", _PAPPL_ATOMIC_GET(&job->k_octets_processed));
 
   if (!ra || cupsArrayFind(ra, "job-printer-up-time"))
     ippAddInteger(client->response, IPP_TAG_JOB, IPP_TAG_INTEGER, "job-printer-up-time", (int)(time(NULL) - client->printer->start_time));
@@ -213,7 +218,7 @@ _papplJobCopyDocumentData(
   job->state     = IPP_JSTATE_ABORTED;
   job->completed = time(NULL);
 
-  pthread_rwlock_wrlock(&client->printer->rwlock);
+  pthread_rwlock_wrlock(&client->printer->jobs_rwlock);
 
   cupsArrayRemove(client->printer->active_jobs, job);
   cupsArrayAdd(client->printer->completed_jobs, job);
@@ -221,7 +226,7 @@ _papplJobCopyDocumentData(
   if (!client->system->clean_time)
     client->system->clean_time = time(NULL) + 60;
 
-  pthread_rwlock_unlock(&client->printer->rwlock);
+  pthread_rwlock_unlock(&client->printer->jobs_rwlock);
 
   ra = cupsArrayNew((cups_array_cb_t)strcmp, NULL, NULL, 0, NULL, NULL);
   cupsArrayAdd(ra, "job-id");
@@ -417,7 +422,7 @@ _papplJobValidateDocumentAttributes(
 
 
   // Check operation attributes...
-  if ((attr = ippFindAttribute(client->request, "compression", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "compression", IPP_TAG_ZERO)) != NULL)
   {
     // If compression is specified, only accept a supported value in a Print-Job
     // or Send-Document request...
@@ -433,7 +438,7 @@ _papplJobValidateDocumentAttributes(
     {
       papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "%s \"compression\"='%s'", op_name, compression);
 
-      ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_KEYWORD, "compression-supplied", NULL, compression);
+      _papplClientIndexAttribute(client, ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_KEYWORD, "compression-supplied", NULL, compression));
 
       if (strcmp(compression, "none"))
       {
@@ -444,7 +449,7 @@ _papplJobValidateDocumentAttributes(
   }
 
   // Is it a format we support?
-  if ((attr = ippFindAttribute(client->request, "document-format", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "document-format", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_MIMETYPE || ippGetGroupTag(attr) != IPP_TAG_OPERATION)
     {
@@ -457,7 +462,7 @@ _papplJobValidateDocumentAttributes(
 
       papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "%s \"document-format\"='%s'", op_name, format);
 
-      ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_MIMETYPE, "document-format-supplied", NULL, format);
+      _papplClientIndexAttribute(client, ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_MIMETYPE, "document-format-supplied", NULL, format));
     }
   }
   else
@@ -467,43 +472,61 @@ _papplJobValidateDocumentAttributes(
       format = "application/octet-stream"; /* Should never happen */
 
     attr = ippAddString(client->request, IPP_TAG_OPERATION, IPP_TAG_MIMETYPE, "document-format", NULL, format);
+    _papplClientIndexAttribute(client, attr);
   }
 
-  if (format && !strcmp(format, "application/octet-stream") && (ippGetOperation(client->request) == IPP_OP_PRINT_JOB || ippGetOperation(client->request) == IPP_OP_SEND_DOCUMENT))
+  if (format && (op == IPP_OP_PRINT_JOB || op == IPP_OP_SEND_DOCUMENT))
   {
-    // Auto-type the file using the first N bytes of the file...
+    // Sniff the first N bytes of the document data so that unknown,
+    // mislabeled, or unprintable documents are rejected before anything is
+    // spooled...
     unsigned char	header[8192];	// First 8k bytes of file
     ssize_t		headersize;	// Number of bytes read
-
+    const char		*detected;	// Detected format
+    bool		known;		// Is the supplied format one we can detect?
 
     memset(header, 0, sizeof(header));
     headersize = httpPeek(client->http, (char *)header, sizeof(header));
+    detected   = detect_format(header, headersize > 0 ? (size_t)headersize : 0);
+    known      = !strcmp(format, "application/pdf") || !strcmp(format, "application/postscript") || !strcmp(format, "image/jpeg") || !strcmp(format, "image/png") || !strcmp(format, "image/pwg-raster") || !strcmp(format, "image/urf");
 
-    if (!memcmp(header, "%PDF", 4))
-      format = "application/pdf";
-    else if (!memcmp(header, "%!", 2))
-      format = "application/postscript";
-    else if (!memcmp(header, "\377\330\377", 3) && header[3] >= 0xe0 && header[3] <= 0xef)
-      format = "image/jpeg";
-    else if (!memcmp(header, "\211PNG", 4))
-      format = "image/png";
-    else if (!memcmp(header, "RaS2PwgR", 8))
-      format = "image/pwg-raster";
-    else if (!memcmp(header, "UNIRAST", 8))
-      format = "image/urf";
-    else if (client->system->mime_cb)
-      format = (client->system->mime_cb)(header, (size_t)headersize, client->system->mime_cbdata);
-    else
-      format = NULL;
+    if (!strcmp(format, "application/octet-stream"))
+    {
+      // Auto-type the file using the first N bytes of the file...
+      if (!detected && client->system->mime_cb)
+        detected = (client->system->mime_cb)(header, (size_t)headersize, client->system->mime_cbdata);
 
-    papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Auto-type header: %02X%02X%02X%02X%02X%02X%02X%02X... format: %s\n", header[0], header[1], header[2], header[3], header[4], header[5], header[6], header[7], format ? format : "unknown");
+      format = detected;
 
-    if (format)
+      papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Auto-type header: %02X%02X%02X%02X%02X%02X%02X%02X... format: %s\n", header[0], header[1], header[2], header[3], header[4], header[5], header[6], header[7], format ? format : "unknown");
+
+      if (format)
+      {
+	papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "%s Auto-typed \"document-format\"='%s'.", op_name, format);
+
+	_papplClientIndexAttribute(client, ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_MIMETYPE, "document-format-detected", NULL, format));
+      }
+    }
+    else if (valid && known && detected && strcmp(format, detected))
     {
-      papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "%s Auto-typed \"document-format\"='%s'.", op_name, format);
+      // Mislabeled document data, route it using the detected format...
+      papplLogClient(client, PAPPL_LOGLEVEL_INFO, "%s \"document-format\"='%s' but data is '%s'.", op_name, format, detected);
+
+      format = detected;
 
-      ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_MIMETYPE, "document-format-detected", NULL, format);
+      _papplClientIndexAttribute(client, ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_MIMETYPE, "document-format-detected", NULL, format));
+    }
+    else if (valid && known && headersize >= 8 && !detected && strncmp(format, "application/", 12))
+    {
+      // Image data always starts with a signature - only reject the data when
+      // we have enough of it to be sure the signature does not match, since
+      // httpPeek may return less than a full signature...
+      papplClientRespondIPP(client, IPP_STATUS_ERROR_DOCUMENT_FORMAT_ERROR, "Document data is not '%s'.", format);
+      valid = false;
     }
+
+    if (valid && format && headersize > 0 && !preflight_document(client, format, header, (size_t)headersize))
+      valid = false;
   }
 
   pthread_rwlock_rdlock(&client->printer->rwlock);
@@ -520,6 +543,32 @@ _papplJobValidateDocumentAttributes(
 }
 
 
+//
+// 'detect_format()' - Detect the format of document data from its header.
+//
+
+static const char *			// O - MIME media type or `NULL` if unknown
+detect_format(
+    const unsigned char *header,	// I - First bytes of document data
+    size_t              headersize)	// I - Number of bytes
+{
+  if (headersize >= 4 && !memcmp(header, "%PDF", 4))
+    return ("application/pdf");
+  else if (headersize >= 2 && !memcmp(header, "%!", 2))
+    return ("application/postscript");
+  else if (headersize >= 3 && !memcmp(header, "\377\330\377", 3))
+    return ("image/jpeg");
+  else if (headersize >= 4 && !memcmp(header, "\211PNG", 4))
+    return ("image/png");
+  else if (headersize >= 8 && !memcmp(header, "RaS2PwgR", 8))
+    return ("image/pwg-raster");
+  else if (headersize >= 8 && !memcmp(header, "UNIRAST", 8))
+    return ("image/urf");
+  else
+    return (NULL);
+}
+
+
 //
 // 'ipp_cancel_job()' - Cancel a job.
 //
@@ -698,7 +747,7 @@ ipp_send_document(
   }
 
   // Make sure we have the "last-document" operation attribute...
-  if ((attr = ippFindAttribute(client->request, "last-document", IPP_TAG_ZERO)) == NULL)
+  if ((attr = _papplClientFindAttribute(client, "last-document", IPP_TAG_ZERO)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing required \"last-document\" attribute.");
     _papplClientFlushDocumentData(client);
@@ -739,8 +788,126 @@ ipp_send_document(
   else
     job->format = client->printer->driver_data.format;
 
+  _papplJobUpdateMemory(job);
+
   pthread_rwlock_unlock(&(client->printer->rwlock));
 
   if (have_data)
     _papplJobCopyDocumentData(client, job);
 }
+
+
+//
+// 'preflight_document()' - Check the header of document data for problems.
+//
+// This function looks at the image dimensions and raster parameters that are
+// available in the first bytes of JPEG, PNG, and PWG raster data and responds
+// with a document-format-error or document-unprintable status as needed.
+// Anything that cannot be determined from the header is left to the filters.
+//
+
+static bool				// O - `true` if OK, `false` if rejected
+preflight_document(
+    pappl_client_t      *client,	// I - Client
+    const char          *format,	// I - Document format
+    const unsigned char *header,	// I - First bytes of document data
+    size_t              headersize)	// I - Number of bytes
+{
+  unsigned	width = 0,		// Image width
+		height = 0;		// Image height
+  bool		have_size = false;	// Do we have the image dimensions?
+
+
+  if (!strcmp(format, "image/jpeg"))
+  {
+    // Scan the JPEG markers for the start-of-frame...
+    size_t	i;			// Current offset
+    unsigned	marker;			// Current marker
+
+    for (i = 2; (i + 9) <= headersize;)
+    {
+      if (header[i] != 0xff)
+        break;
+
+      marker = header[i + 1];
+
+      if (marker == 0xff)
+      {
+        i ++;
+        continue;
+      }
+      else if (marker >= 0xc0 && marker <= 0xcf && marker != 0xc4 && marker != 0xc8 && marker != 0xcc)
+      {
+        height    = (unsigned)((header[i + 5] << 8) | header[i + 6]);
+        width     = (unsigned)((header[i + 7] << 8) | header[i + 8]);
+        have_size = true;
+        break;
+      }
+      else if (marker == 0x01 || (marker >= 0xd0 && marker <= 0xd7))
+        i += 2;
+      else
+        i += 2 + (size_t)((header[i + 2] << 8) | header[i + 3]);
+    }
+  }
+  else if (!strcmp(format, "image/png"))
+  {
+    // The IHDR chunk always comes first...
+    if (headersize >= 24 && !memcmp(header + 12, "IHDR", 4))
+    {
+      width     = (unsigned)((header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19]);
+      height    = (unsigned)((header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23]);
+      have_size = true;
+    }
+  }
+  else if (!strcmp(format, "image/pwg-raster") && headersize >= 1800)
+  {
+    // Check the first page header, which follows the sync word...
+    const unsigned char *page = header + 4;
+					// Page header
+    unsigned	bits_per_color,		// cupsBitsPerColor
+		bits_per_pixel,		// cupsBitsPerPixel
+		bytes_per_line,		// cupsBytesPerLine
+		color_order;		// cupsColorOrder
+
+    width          = (unsigned)((page[372] << 24) | (page[373] << 16) | (page[374] << 8) | page[375]);
+    height         = (unsigned)((page[376] << 24) | (page[377] << 16) | (page[378] << 8) | page[379]);
+    bits_per_color = (unsigned)((page[384] << 24) | (page[385] << 16) | (page[386] << 8) | page[387]);
+    bits_per_pixel = (unsigned)((page[388] << 24) | (page[389] << 16) | (page[390] << 8) | page[391]);
+    bytes_per_line = (unsigned)((page[392] << 24) | (page[393] << 16) | (page[394] << 8) | page[395]);
+    color_order    = (unsigned)((page[396] << 24) | (page[397] << 16) | (page[398] << 8) | page[399]);
+
+    if (width == 0 || height == 0 || (bits_per_color != 1 && bits_per_color != 8) || color_order != CUPS_ORDER_CHUNKED || bytes_per_line != ((width * bits_per_pixel + 7) / 8))
+    {
+      papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Bad raster data seen.");
+      papplClientRespondIPP(client, IPP_STATUS_ERROR_DOCUMENT_FORMAT_ERROR, "Bad raster data.");
+      return (false);
+    }
+
+    if (bits_per_pixel > 8 && !(client->printer->driver_data.color_supported & PAPPL_COLOR_MODE_COLOR))
+    {
+      papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unsupported raster data seen.");
+      papplClientRespondIPP(client, IPP_STATUS_ERROR_DOCUMENT_UNPRINTABLE, "Unsupported raster data.");
+      return (false);
+    }
+
+    return (true);
+  }
+
+  if (have_size)
+  {
+    papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Image dimensions are %ux%u.", width, height);
+
+    if (width == 0 || height == 0)
+    {
+      papplClientRespondIPP(client, IPP_STATUS_ERROR_DOCUMENT_FORMAT_ERROR, "Bad image dimensions %ux%u.", width, height);
+      return (false);
+    }
+    else if ((size_t)width * (size_t)height > _PAPPL_MAX_IMAGE_PIXELS)
+    {
+      papplClientRespondIPP(client, IPP_STATUS_ERROR_DOCUMENT_UNPRINTABLE, "Image dimensions %ux%u are too large.", width, height);
+      return (false);
+    }
+  }
+
+  return (true);
+}
@@ -15,6 +15,14 @@
 #  include "log.h"
 
 
+//
+// Constants...
+//
+
+#  define _PAPPL_MAX_IMAGE_PIXELS	(128 * 1024 * 1024)
+					// Maximum number of pixels in a JPEG or PNG image
+
+
 //
 // Types and structures...
 //
@@ -37,11 +45,17 @@ struct _pappl_job_s			// Job data
 			processing,		// "[date-]time-at-processing" value
 			completed;		// "[date-]time-at-completed" value
   int			impressions,		// "job-impressions" value
-			impcompleted;		// "job-impressions-completed" value
+			impcompleted,		// "job-impressions-completed" value (atomic)
+			impcurrent,		// Impression being printed or `0` if none (atomic)
+			k_octets_processed;	// "job-k-octets-processed" value (atomic)
+  size_t		bytes_processed;	// Bytes processed by the job thread
+  size_t		memused;		// Bytes recorded for memory accounting
   ipp_t			*attrs;			// Static attributes
   char			*filename;		// Print file name
+  off_t			filesize;		// Size of print file, `0` if not known
   int			fd;			// Print file descriptor
   bool			streaming;		// Streaming job?
+  bool			compressing;		// Is the document data being compressed?
   void			*data;			// Per-job driver data
 };
 
@@ -50,11 +64,14 @@ struct _pappl_job_s			// Job data
 // Functions...
 //
 
+extern void		_papplJobAddBytesProcessed(pappl_job_t *job, size_t bytes) _PAPPL_PRIVATE;
 extern int		_papplJobCompareActive(pappl_job_t *a, pappl_job_t *b) _PAPPL_PRIVATE;
 extern int		_papplJobCompareAll(pappl_job_t *a, pappl_job_t *b) _PAPPL_PRIVATE;
 extern int		_papplJobCompareCompleted(pappl_job_t *a, pappl_job_t *b) _PAPPL_PRIVATE;
+extern bool		_papplJobCompressFileNoLock(pappl_job_t *job) _PAPPL_PRIVATE;
 extern void		_papplJobCopyAttributes(pappl_job_t *job, pappl_client_t *client, cups_array_t *ra) _PAPPL_PRIVATE;
 extern void		_papplJobCopyDocumentData(pappl_client_t *client, pappl_job_t *job) _PAPPL_PRIVATE;
+extern bool		_papplJobCopyFile(pappl_job_t *job, const char *srcfile, char *dstfile, size_t dstsize) _PAPPL_PRIVATE;
 extern void		_papplJobCopyState(pappl_job_t *job, ipp_tag_t group_tag, ipp_t *ipp, cups_array_t *ra) _PAPPL_PRIVATE;
 extern pappl_job_t	*_papplJobCreate(pappl_printer_t *printer, int job_id, const char *username, const char *format, const char *job_name, ipp_t *attrs) _PAPPL_PRIVATE;
 extern void		_papplJobDelete(pappl_job_t *job) _PAPPL_PRIVATE;
@@ -71,6 +88,7 @@ extern const char	*_papplJobReasonString(pappl_jreason_t reason) _PAPPL_PRIVATE;
 extern void		_papplJobRemoveFile(pappl_job_t *job) _PAPPL_PRIVATE;
 extern void		_papplJobSetState(pappl_job_t *job, ipp_jstate_t state) _PAPPL_PRIVATE;
 extern void		_papplJobSubmitFile(pappl_job_t *job, const char *filename) _PAPPL_PRIVATE;
+extern void		_papplJobUpdateMemory(pappl_job_t *job) _PAPPL_PRIVATE;
 extern bool		_papplJobValidateDocumentAttributes(pappl_client_t *client) _PAPPL_PRIVATE;
 
 
@@ -12,6 +12,7 @@
 //
 
 #include "pappl-private.h"
+#include "device-private.h"
 
 
 //
@@ -174,12 +175,12 @@ papplJobCreatePrintOptions(
   {
     options->media.source[0] = '\0';
 
-    _papplMediaColImport(ippGetCollection(attr, 0), &options->media);
+    _papplMediaColImport(printer, ippGetCollection(attr, 0), &options->media);
   }
   else if ((attr = ippFindAttribute(job->attrs, "media", IPP_TAG_ZERO)) != NULL)
   {
     const char	*pwg_name = ippGetString(attr, 0, NULL);
-    pwg_media_t	*pwg_media = pwgMediaForPWG(pwg_name);
+    pwg_media_t	*pwg_media = _papplPrinterFindMedia(printer, pwg_name);
 
     if (pwg_name && pwg_media)
     {
@@ -416,7 +417,7 @@ papplJobCreatePrintOptions(
 
   // Generate the raster header...
 #if CUPS_VERSION_MAJOR < 3
-  cupsRasterInitPWGHeader(&options->header, pwgMediaForPWG(options->media.size_name), raster_type, options->printer_resolution[0], options->printer_resolution[1], _papplSidesString(options->sides), sheet_back[printer->driver_data.duplex]);
+  cupsRasterInitPWGHeader(&options->header, _papplPrinterFindMedia(printer, options->media.size_name), raster_type, options->printer_resolution[0], options->printer_resolution[1], _papplSidesString(options->sides), sheet_back[printer->driver_data.duplex]);
   for (i = 0; i < (int)(sizeof(media_positions) / sizeof(media_positions[0])); i ++)
   {
     if (!strcmp(media_positions[i], options->media.source))
@@ -523,6 +524,26 @@ papplJobDeletePrintOptions(
 }
 
 
+//
+// '_papplJobAddBytesProcessed()' - Add to the number of bytes processed for a
+//                                  job.
+//
+// Only the job processing thread updates the byte count, so the running total
+// is kept locally and only the "job-k-octets-processed" value is published.
+// Filters call this function as they consume document data.
+//
+
+void
+_papplJobAddBytesProcessed(
+    pappl_job_t *job,			// I - Job
+    size_t      bytes)			// I - Number of bytes processed
+{
+  job->bytes_processed += bytes;
+
+  _PAPPL_ATOMIC_SET(&job->k_octets_processed, (int)((job->bytes_processed + 1023) / 1024));
+}
+
+
 //
 // '_papplJobProcess()' - Process a print job.
 //
@@ -531,6 +552,7 @@ void *					// O - Thread exit status
 _papplJobProcess(pappl_job_t *job)	// I - Job
 {
   _pappl_mime_filter_t	*filter;	// Filter for printing
+  struct stat		fileinfo;	// Print file information
 
 
   // Start processing the job...
@@ -556,6 +578,10 @@ _papplJobProcess(pappl_job_t *job)	// I - Job
       papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to process job with format '%s'.", job->format);
       job->state = IPP_JSTATE_ABORTED;
     }
+
+    // Account for any document data the filter didn't report...
+    if (job->state == IPP_JSTATE_PROCESSING && !stat(job->filename, &fileinfo) && (size_t)fileinfo.st_size > job->bytes_processed)
+      _papplJobAddBytesProcessed(job, (size_t)fileinfo.st_size - job->bytes_processed);
   }
 
   // Move the job to a completed state...
@@ -590,6 +616,7 @@ _papplJobProcessRaster(
   unsigned		page = 0,	// Current page
 			x,		// Current column
 			y;		// Current line
+  size_t		ripmem = 0;	// Bytes recorded for raster lines
 
 
   // Start processing the job...
@@ -632,7 +659,7 @@ _papplJobProcessRaster(
       break;
 
     page ++;
-    papplJobSetImpressionsCompleted(job, 1);
+    _PAPPL_ATOMIC_SET(&job->impcurrent, (int)page);
 
     papplLogJob(job, PAPPL_LOGLEVEL_INFO, "Page %u raster data is %ux%ux%u (%s)", page, header.cupsWidth, header.cupsHeight, header.cupsBitsPerPixel, cups_cspace_string(header.cupsColorSpace));
 
@@ -702,6 +729,8 @@ _papplJobProcessRaster(
       break;
     }
 
+    _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_RIP, &ripmem, options->header.cupsBytesPerLine + (options->header.cupsBytesPerLine > header.cupsBytesPerLine ? options->header.cupsBytesPerLine : header.cupsBytesPerLine));
+
     for (y = 0; !job->is_canceled && y < header.cupsHeight && y < options->header.cupsHeight; y ++)
     {
       if (cupsRasterReadPixels(ras, pixels, header.cupsBytesPerLine))
@@ -804,12 +833,18 @@ _papplJobProcessRaster(
     free(pixels);
     free(line);
 
+    _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_RIP, &ripmem, 0);
+
+    _papplJobAddBytesProcessed(job, (size_t)header.cupsBytesPerLine * y);
+
     if (!(printer->driver_data.rendpage_cb)(job, options, job->printer->device, page))
     {
       job->state = IPP_JSTATE_ABORTED;
       break;
     }
 
+    papplJobSetImpressionsCompleted(job, 1);
+
     if (job->is_canceled)
       break;
     else if (y < header.cupsHeight)
@@ -941,6 +976,8 @@ filter_raw(pappl_job_t    *job,		// I - Job
 
 
   papplJobSetImpressions(job, 1);
+  _PAPPL_ATOMIC_SET(&job->impcurrent, 1);
+
   options = papplJobCreatePrintOptions(job, 0, job->printer->driver_data.ppm_color > 0);
 
   if (!(job->printer->driver_data.printfile_cb)(job, options, device))
@@ -967,6 +1004,7 @@ finish_job(pappl_job_t  *job)		// I - Job
 					// Printer
 
 
+  pthread_rwlock_wrlock(&printer->jobs_rwlock);
   pthread_rwlock_wrlock(&printer->rwlock);
   pthread_rwlock_wrlock(&job->rwlock);
 
@@ -975,7 +1013,9 @@ finish_job(pappl_job_t  *job)		// I - Job
   else if (job->state == IPP_JSTATE_PROCESSING)
     job->state = IPP_JSTATE_COMPLETED;
 
-  papplLogJob(job, PAPPL_LOGLEVEL_INFO, "%s, job-impressions-completed=%d.", job->state == IPP_JSTATE_COMPLETED ? "Completed" : job->state == IPP_JSTATE_CANCELED ? "Canceled" : "Aborted", job->impcompleted);
+  _PAPPL_ATOMIC_SET(&job->impcurrent, 0);
+
+  papplLogJob(job, PAPPL_LOGLEVEL_INFO, "%s, job-impressions-completed=%d.", job->state == IPP_JSTATE_COMPLETED ? "Completed" : job->state == IPP_JSTATE_CANCELED ? "Canceled" : "Aborted", papplJobGetImpressionsCompleted(job));
 
   if (job->state >= IPP_JSTATE_CANCELED)
     job->completed = time(NULL);
@@ -1002,21 +1042,30 @@ finish_job(pappl_job_t  *job)		// I - Job
   }
 
   printer->state_time = time(NULL);
+  printer->state_changes ++;
 
-  cupsArrayRemove(printer->active_jobs, job);
-  cupsArrayAdd(printer->completed_jobs, job);
-
-  printer->impcompleted += job->impcompleted;
+  printer->impcompleted += papplJobGetImpressionsCompleted(job);
 
   if (!job->system->clean_time)
     job->system->clean_time = time(NULL) + 60;
 
   _papplSystemAddEventNoLock(printer->system, printer, NULL, PAPPL_EVENT_PRINTER_STATE_CHANGED, NULL);
 
+  pthread_rwlock_unlock(&printer->rwlock);
+
+  cupsArrayRemove(printer->active_jobs, job);
+  cupsArrayAdd(printer->completed_jobs, job);
+
   if (printer->max_preserved_jobs > 0)
+  {
+    // Compress any preserved document data in the background so the printer
+    // can move on to the next job...
+    _papplJobCompressFileNoLock(job);
+
     _papplPrinterCleanJobsNoLock(printer);
+  }
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
 
   _papplSystemConfigChanged(printer->system);
 
@@ -1024,7 +1073,7 @@ finish_job(pappl_job_t  *job)		// I - Job
   {
     papplPrinterDelete(printer);
   }
-  else if (cupsArrayGetCount(printer->active_jobs) > 0)
+  else if (papplPrinterGetNumberOfActiveJobs(printer) > 0)
   {
     _papplPrinterCheckJobs(printer);
   }
@@ -1058,6 +1107,7 @@ start_job(pappl_job_t *job)		// I - Job
   pappl_printer_t *printer = job->printer;
 					// Printer
   bool	first_open = true;		// Is this the first time we try to open the device?
+  int	delay = _PAPPL_DEVICE_RETRY_MIN;// Delay before next attempt in milliseconds
 
 
   // Move the job to the 'processing' state...
@@ -1081,21 +1131,29 @@ start_job(pappl_job_t *job)		// I - Job
 
     while (printer->device_in_use && !printer->is_deleted && !job->is_canceled && papplSystemIsRunning(printer->system))
     {
+      // papplPrinterCloseDevice signals the device condition when done...
       pthread_rwlock_unlock(&printer->rwlock);
-      sleep(1);
+      _papplPrinterWaitDevice(printer, _PAPPL_DEVICE_RETRY_MAX);
       pthread_rwlock_wrlock(&printer->rwlock);
     }
   }
 
   while (!printer->device && !printer->is_deleted && !job->is_canceled && papplSystemIsRunning(printer->system))
   {
-    papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Opening device for job %d.", job->job_id);
+    // After the first failure, only do a full open when a quick probe says the
+    // device is reachable...
+    if (first_open || _papplDeviceProbe(printer->device_uri))
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Opening device for job %d.", job->job_id);
 
-    printer->device = papplDeviceOpen(printer->device_uri, job->name, papplLogDevice, job->system);
+      printer->device = papplDeviceOpen(printer->device_uri, job->name, papplLogDevice, job->system);
+    }
 
     if (!printer->device && !printer->is_deleted && !job->is_canceled)
     {
-      // Log that the printer is unavailable then sleep for 5 seconds to retry.
+      int	wait_msecs;		// Delay with jitter
+
+      // Log that the printer is unavailable then wait to retry.
       if (first_open)
       {
         papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to open device '%s', pausing queue until printer becomes available.", printer->device_uri);
@@ -1103,14 +1161,31 @@ start_job(pappl_job_t *job)		// I - Job
 
 	printer->state      = IPP_PSTATE_STOPPED;
 	printer->state_time = time(NULL);
+	printer->state_changes ++;
       }
       else
       {
         papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Still unable to open device.");
       }
 
+      // Use exponential backoff with +/-25% jitter so that many queues for
+      // the same (offline) printer don't retry in lock step...
+      wait_msecs = delay * (75 + (int)(papplGetRand() % 51)) / 100;
+
+      if ((delay *= 2) > _PAPPL_DEVICE_RETRY_MAX)
+        delay = _PAPPL_DEVICE_RETRY_MAX;
+
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Retrying device in %d.%03d seconds.", wait_msecs / 1000, wait_msecs % 1000);
+
       pthread_rwlock_unlock(&printer->rwlock);
-      sleep(5);
+
+      if (_papplPrinterWaitDevice(printer, wait_msecs))
+      {
+        // Device availability changed, retry right away with a short delay...
+        papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Device availability changed.");
+        delay = _PAPPL_DEVICE_RETRY_MIN;
+      }
+
       pthread_rwlock_wrlock(&printer->rwlock);
     }
   }
@@ -1129,6 +1204,7 @@ start_job(pappl_job_t *job)		// I - Job
     // Move the printer to the 'processing' state...
     printer->state      = IPP_PSTATE_PROCESSING;
     printer->state_time = time(NULL);
+    printer->state_changes ++;
   }
 
   _papplSystemAddEventNoLock(printer->system, printer, NULL, PAPPL_EVENT_PRINTER_STATE_CHANGED, NULL);
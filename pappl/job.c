@@ -13,6 +13,17 @@
 //
 
 #include "pappl-private.h"
+#ifdef HAVE_LINUX_FS_H
+#  include <linux/fs.h>
+#  include <sys/ioctl.h>
+#endif // HAVE_LINUX_FS_H
+
+
+//
+// Local functions...
+//
+
+static void	*compress_file(pappl_job_t *job);
 
 
 //
@@ -29,7 +40,7 @@ papplJobCancel(pappl_job_t *job)	// I - Job
   if (!job)
     return;
 
-  pthread_rwlock_wrlock(&job->printer->rwlock);
+  pthread_rwlock_wrlock(&job->printer->jobs_rwlock);
   pthread_rwlock_wrlock(&job->rwlock);
 
   if (job->state == IPP_JSTATE_PROCESSING || (job->state == IPP_JSTATE_HELD && job->fd >= 0))
@@ -51,12 +62,194 @@ papplJobCancel(pappl_job_t *job)	// I - Job
     job->system->clean_time = time(NULL) + 60;
 
   pthread_rwlock_unlock(&job->rwlock);
-  pthread_rwlock_unlock(&job->printer->rwlock);
+  pthread_rwlock_unlock(&job->printer->jobs_rwlock);
+
+  if (job->is_canceled)
+    _papplPrinterWakeDevice(job->printer);
 
   papplSystemAddEvent(job->system, job->printer, job, PAPPL_EVENT_JOB_COMPLETED, NULL);
 }
 
 
+//
+// '_papplJobCompressFileNoLock()' - Start compressing the document data of a
+//                                   preserved job.
+//
+// The document is compressed in a background thread using the fastest gzip
+// compression level and then replaces the original file.  Readers that use the
+// CUPS file API (reprinting, etc.) decompress the document transparently.
+//
+// The caller must hold a writer lock on the printer's job arrays
+// ("jobs_rwlock").  The job is not cleaned up while its document is being
+// compressed and the printer is not deleted until the compression thread has
+// finished.
+//
+
+bool					// O - `true` if started, `false` otherwise
+_papplJobCompressFileNoLock(
+    pappl_job_t *job)			// I - Job
+{
+  pappl_printer_t *printer = job->printer;
+					// Printer
+  size_t	len;			// Length of filename
+
+
+  if (job->compressing || printer->is_deleted || !job->filename || (len = strlen(job->filename)) <= 3 || !strcmp(job->filename + len - 3, ".gz"))
+    return (false);
+
+  job->compressing = true;
+
+  pthread_mutex_lock(&printer->threads_mutex);
+  printer->num_compressing ++;
+  pthread_mutex_unlock(&printer->threads_mutex);
+
+  if (!_papplSystemCreateThread(job->system, PAPPL_THREAD_JOB, NULL, (void *(*)(void *))compress_file, job))
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to create document compression thread: %s", strerror(errno));
+
+    job->compressing = false;
+
+    pthread_mutex_lock(&printer->threads_mutex);
+    printer->num_compressing --;
+    pthread_cond_broadcast(&printer->threads_cond);
+    pthread_mutex_unlock(&printer->threads_mutex);
+
+    return (false);
+  }
+
+  return (true);
+}
+
+
+//
+// '_papplJobCopyFile()' - Copy a document file for a job.
+//
+// This function duplicates the document file "srcfile" for "job", storing the
+// new filename in the "dstfile" buffer.  Uncompressed files are reflinked or
+// copied by the kernel when possible, and only copied through a buffer as a
+// last resort.  Compressed files are always decompressed.
+//
+// Preserved documents are not compressed on filesystems that support reflinks,
+// so reprinting them shares the existing data blocks.
+//
+
+bool					// O - `true` on success, `false` otherwise
+_papplJobCopyFile(
+    pappl_job_t *job,			// I - Job
+    const char  *srcfile,		// I - Source filename
+    char        *dstfile,		// I - Destination filename buffer
+    size_t      dstsize)		// I - Size of destination filename buffer
+{
+  int		srcfd,			// Source file
+		dstfd;			// Destination file
+  struct stat	srcinfo;		// Source file information
+  size_t	srclen = strlen(srcfile);
+					// Length of source filename
+  char		buffer[65536];		// Copy buffer
+  ssize_t	bytes = 0;		// Bytes read
+  bool		ret = false;		// Return value
+
+
+  if ((dstfd = papplJobOpenFile(job, dstfile, dstsize, job->system->directory, NULL, "w")) < 0)
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to create print file: %s", strerror(errno));
+    return (false);
+  }
+
+  if (srclen > 3 && !strcmp(srcfile + srclen - 3, ".gz"))
+  {
+    // Preserved document data is compressed, decompress it...
+    cups_file_t	*srcfp;			// Source file stream
+
+    if ((srcfp = cupsFileOpen(srcfile, "r")) != NULL)
+    {
+      while ((bytes = cupsFileRead(srcfp, buffer, sizeof(buffer))) > 0)
+      {
+        if (write(dstfd, buffer, (size_t)bytes) < 0)
+          break;
+      }
+
+      ret = bytes == 0;
+
+      cupsFileClose(srcfp);
+    }
+
+    goto finish;
+  }
+
+  if ((srcfd = open(srcfile, O_RDONLY | O_NOFOLLOW | O_CLOEXEC | O_BINARY)) < 0)
+    goto finish;
+
+  if (fstat(srcfd, &srcinfo))
+  {
+    close(srcfd);
+    goto finish;
+  }
+
+#ifdef HAVE_FICLONE
+  // Share the data blocks on filesystems that support reflinks...
+  if (!ioctl(dstfd, FICLONE, srcfd))
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_DEBUG, "Cloned document data from '%s'.", srcfile);
+    ret = true;
+  }
+#endif // HAVE_FICLONE
+
+#ifdef HAVE_COPY_FILE_RANGE
+  if (!ret)
+  {
+    // Let the kernel copy the data...
+    off_t	remaining;		// Remaining bytes to copy
+
+    for (remaining = srcinfo.st_size; remaining > 0; remaining -= bytes)
+    {
+      if ((bytes = copy_file_range(srcfd, NULL, dstfd, NULL, (size_t)remaining, 0)) <= 0)
+	break;
+    }
+
+    if (remaining == 0)
+    {
+      papplLogJob(job, PAPPL_LOGLEVEL_DEBUG, "Copied document data from '%s' in the kernel.", srcfile);
+      ret = true;
+    }
+    else
+    {
+      // Start over, the buffered copy rewrites the same data from the
+      // beginning...
+      lseek(srcfd, 0, SEEK_SET);
+      lseek(dstfd, 0, SEEK_SET);
+    }
+  }
+#endif // HAVE_COPY_FILE_RANGE
+
+  if (!ret)
+  {
+    // Copy the data the hard way...
+    while ((bytes = read(srcfd, buffer, sizeof(buffer))) > 0)
+    {
+      if (write(dstfd, buffer, (size_t)bytes) < 0)
+        break;
+    }
+
+    ret = bytes == 0;
+  }
+
+  close(srcfd);
+
+  finish:
+
+  close(dstfd);
+
+  if (!ret)
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to copy print file '%s': %s", srcfile, strerror(errno));
+    unlink(dstfile);
+  }
+
+  return (ret);
+}
+
+
 //
 // '_papplJobCreate()' - Create a new/existing job object.
 //
@@ -79,11 +272,11 @@ _papplJobCreate(
 
 
 
-  pthread_rwlock_wrlock(&printer->rwlock);
+  pthread_rwlock_wrlock(&printer->jobs_rwlock);
 
   if (printer->max_active_jobs > 0 && (int)cupsArrayGetCount(printer->active_jobs) >= printer->max_active_jobs)
   {
-    pthread_rwlock_unlock(&printer->rwlock);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
     return (NULL);
   }
 
@@ -91,7 +284,7 @@ _papplJobCreate(
   if ((job = calloc(1, sizeof(pappl_job_t))) == NULL)
   {
     papplLog(printer->system, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for job: %s", strerror(errno));
-    pthread_rwlock_unlock(&printer->rwlock);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
     return (NULL);
   }
 
@@ -137,7 +330,7 @@ _papplJobCreate(
     job->impressions = ippGetInteger(attr, 0);
 
   // Add job description attributes and add to the jobs array...
-  job->job_id = job_id > 0 ? job_id : printer->next_job_id ++;
+  job->job_id = job_id > 0 ? job_id : _PAPPL_ATOMIC_ADD(&printer->next_job_id, 1);
 
   if ((attr = ippFindAttribute(attrs, "printer-uri", IPP_TAG_URI)) != NULL)
   {
@@ -158,12 +351,14 @@ _papplJobCreate(
   ippAddString(job->attrs, IPP_TAG_JOB, IPP_TAG_URI, "job-uuid", NULL, job_uuid);
   ippAddString(job->attrs, IPP_TAG_JOB, IPP_TAG_URI, "job-printer-uri", NULL, job_printer_uri);
 
+  _papplJobUpdateMemory(job);
+
   cupsArrayAdd(printer->all_jobs, job);
 
   if (!job_id)
     cupsArrayAdd(printer->active_jobs, job);
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
 
   papplSystemAddEvent(printer->system, printer, job, PAPPL_EVENT_JOB_CREATED, NULL);
 
@@ -233,6 +428,8 @@ _papplJobDelete(pappl_job_t *job)	// I - Job
 {
   papplLogJob(job, PAPPL_LOGLEVEL_INFO, "Removing job from history.");
 
+  _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_JOBS, &job->memused, 0);
+
   pthread_rwlock_destroy(&job->rwlock);
 
   ippDelete(job->attrs);
@@ -386,6 +583,9 @@ _papplJobRemoveFile(pappl_job_t *job)	// I - Job
 
   free(job->filename);
   job->filename = NULL;
+  job->filesize = 0;
+
+  _papplJobUpdateMemory(job);
 }
 
 
@@ -458,6 +658,8 @@ _papplJobSubmitFile(
   // Save the print file information...
   if ((job->filename = strdup(filename)) != NULL)
   {
+    _papplJobUpdateMemory(job);
+
     // Process the job...
     job->state = IPP_JSTATE_PENDING;
 
@@ -477,10 +679,10 @@ _papplJobSubmitFile(
     if (!strncmp(filename, job->system->directory, dirlen) && filename[dirlen] == '/')
       unlink(filename);
 
-    pthread_rwlock_wrlock(&job->printer->rwlock);
+    pthread_rwlock_wrlock(&job->printer->jobs_rwlock);
     cupsArrayRemove(job->printer->active_jobs, job);
     cupsArrayAdd(job->printer->completed_jobs, job);
-    pthread_rwlock_unlock(&job->printer->rwlock);
+    pthread_rwlock_unlock(&job->printer->jobs_rwlock);
 
     if (!job->system->clean_time)
       job->system->clean_time = time(NULL) + 60;
@@ -488,6 +690,32 @@ _papplJobSubmitFile(
 }
 
 
+//
+// '_papplJobUpdateMemory()' - Update the memory recorded for a job.
+//
+// This function must be called after the job's attributes, file name, or
+// message change.  The caller must hold the job's write lock or otherwise
+// have exclusive access to the job.
+//
+
+void
+_papplJobUpdateMemory(pappl_job_t *job)	// I - Job
+{
+  size_t	used = sizeof(pappl_job_t);
+					// Bytes used by job
+
+
+  if (job->attrs)
+    used += ippLength(job->attrs);
+  if (job->filename)
+    used += strlen(job->filename) + 1;
+  if (job->message)
+    used += strlen(job->message) + 1;
+
+  _papplSystemUpdateMemory(job->system, PAPPL_MEMORY_JOBS, &job->memused, used);
+}
+
+
 //
 // '_papplPrinterCheckJobs()' - Check for new jobs to process.
 //
@@ -522,7 +750,7 @@ _papplPrinterCheckJobs(
     return;
   }
 
-  pthread_rwlock_wrlock(&printer->rwlock);
+  pthread_rwlock_wrlock(&printer->jobs_rwlock);
 
   // Enumerate the jobs.  Since we have a writer (exclusive) lock, we are the
   // only thread enumerating and can use cupsArrayGetFirst/Last...
@@ -531,11 +759,9 @@ _papplPrinterCheckJobs(
   {
     if (job->state == IPP_JSTATE_PENDING)
     {
-      pthread_t	t;			// Thread
-
       papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Starting job %d.", job->job_id);
 
-      if (pthread_create(&t, NULL, (void *(*)(void *))_papplJobProcess, job))
+      if (!_papplSystemCreateThread(printer->system, PAPPL_THREAD_JOB, NULL, (void *(*)(void *))_papplJobProcess, job))
       {
 	job->state     = IPP_JSTATE_ABORTED;
 	job->completed = time(NULL);
@@ -546,8 +772,6 @@ _papplPrinterCheckJobs(
 	if (!printer->system->clean_time)
 	  printer->system->clean_time = time(NULL) + 60;
       }
-      else
-	pthread_detach(t);
       break;
     }
   }
@@ -555,13 +779,16 @@ _papplPrinterCheckJobs(
   if (!job)
     papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "No jobs to process at this time.");
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
 }
 
 
 //
 // '_papplPrinterCleanJobsNoLock()' - Clean completed jobs for a printer.
 //
+// The caller must hold a writer lock on the printer's job arrays
+// ("jobs_rwlock").
+//
 
 void
 _papplPrinterCleanJobsNoLock(
@@ -570,6 +797,8 @@ _papplPrinterCleanJobsNoLock(
   time_t	cleantime;		// Clean time
   pappl_job_t	*job;			// Current job
   int		preserved;		// Number of preserved jobs
+  size_t	preserved_bytes = 0;	// Bytes of preserved document data
+  struct stat	fileinfo;		// Document file information
 
 
   if (cupsArrayGetCount(printer->completed_jobs) == 0 || (printer->max_preserved_jobs == 0 && printer->max_completed_jobs <= 0))
@@ -579,7 +808,13 @@ _papplPrinterCleanJobsNoLock(
   // only thread enumerating and can use cupsArrayGetFirst/Last...
   for (job = (pappl_job_t *)cupsArrayGetFirst(printer->completed_jobs), cleantime = time(NULL) - 60, preserved = 0; job; job = (pappl_job_t *)cupsArrayGetNext(printer->completed_jobs))
   {
-    if (job->completed && job->completed < cleantime && printer->max_completed_jobs > 0 && (int)cupsArrayGetCount(printer->completed_jobs) > printer->max_completed_jobs)
+    if (job->compressing)
+    {
+      // Leave jobs alone while their document data is being compressed, the
+      // compression thread cleans up again when it is done...
+      preserved ++;
+    }
+    else if (job->completed && job->completed < cleantime && printer->max_completed_jobs > 0 && (int)cupsArrayGetCount(printer->completed_jobs) > printer->max_completed_jobs)
     {
       cupsArrayRemove(printer->completed_jobs, job);
       cupsArrayRemove(printer->all_jobs, job);
@@ -588,9 +823,22 @@ _papplPrinterCleanJobsNoLock(
     {
       if (job->filename)
       {
+        if (!job->filesize && !stat(job->filename, &fileinfo))
+          job->filesize = fileinfo.st_size;
+
 	preserved ++;
+	preserved_bytes += (size_t)job->filesize;
+
 	if (preserved > printer->max_preserved_jobs)
+	{
+	  _papplJobRemoveFile(job);
+	}
+	else if (printer->max_preserved_bytes > 0 && preserved_bytes > printer->max_preserved_bytes)
+	{
+	  // Over the byte quota, remove the document data for this older job...
+	  preserved_bytes -= (size_t)job->filesize;
 	  _papplJobRemoveFile(job);
+	}
       }
     }
     else
@@ -616,9 +864,9 @@ papplPrinterFindJob(
 
   key.job_id = job_id;
 
-  pthread_rwlock_rdlock(&(printer->rwlock));
+  pthread_rwlock_rdlock(&(printer->jobs_rwlock));
   job = (pappl_job_t *)cupsArrayFind(printer->all_jobs, &key);
-  pthread_rwlock_unlock(&(printer->rwlock));
+  pthread_rwlock_unlock(&(printer->jobs_rwlock));
 
   return (job);
 }
@@ -655,10 +903,134 @@ papplSystemCleanJobs(
   {
     printer = (pappl_printer_t *)cupsArrayGetElement(system->printers, i);
 
-    pthread_rwlock_wrlock(&printer->rwlock);
+    pthread_rwlock_wrlock(&printer->jobs_rwlock);
     _papplPrinterCleanJobsNoLock(printer);
-    pthread_rwlock_unlock(&printer->rwlock);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
   }
 
   pthread_rwlock_unlock(&system->rwlock);
 }
+
+
+//
+// 'compress_file()' - Compress the document data of a preserved job.
+//
+// This function runs in a separate thread started by
+// @link _papplJobCompressFileNoLock@.
+//
+
+static void *				// O - Thread exit status
+compress_file(pappl_job_t *job)		// I - Job
+{
+  pappl_printer_t *printer = job->printer;
+					// Printer
+  char		srcname[1024],		// Original filename
+		dstname[1024],		// Compressed filename
+		*newname;		// New job filename
+  int		srcfd,			// Original file
+		dstfd = -1;		// Compressed file
+  cups_file_t	*dstfp = NULL;		// Compressed file stream
+  char		buffer[65536];		// Copy buffer
+  ssize_t	bytes = 0;		// Bytes read
+  bool		ret = false;		// Compressed successfully?
+  struct stat	dstinfo;		// Compressed file information
+
+
+  // Get the current filename - the job cannot be deleted while it is being
+  // compressed...
+  pthread_rwlock_rdlock(&printer->jobs_rwlock);
+  papplCopyString(srcname, job->filename ? job->filename : "", sizeof(srcname));
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
+
+  // Compress the document...
+  snprintf(dstname, sizeof(dstname), "%s.gz", srcname);
+
+  if (srcname[0] && (srcfd = open(srcname, O_RDONLY | O_NOFOLLOW | O_CLOEXEC | O_BINARY)) >= 0)
+  {
+    if ((dstfd = open(dstname, O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC | O_BINARY, 0600)) < 0)
+    {
+      papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to create '%s': %s", dstname, strerror(errno));
+    }
+#ifdef HAVE_FICLONE
+    else if (!ioctl(dstfd, FICLONE, srcfd))
+    {
+      // The filesystem supports reflinks, so reprinting the job can share the
+      // data blocks of the uncompressed document without using any extra disk
+      // space or time to decompress it...
+      papplLogJob(job, PAPPL_LOGLEVEL_DEBUG, "Not compressing document data on a filesystem that supports reflinks.");
+      close(dstfd);
+      unlink(dstname);
+    }
+#endif // HAVE_FICLONE
+    else if ((dstfp = cupsFileOpenFd(dstfd, "w1")) != NULL)
+    {
+      ret = true;
+
+      while ((bytes = read(srcfd, buffer, sizeof(buffer))) > 0)
+      {
+	if (cupsFileWrite(dstfp, buffer, (size_t)bytes) < 0)
+	{
+	  ret = false;
+	  break;
+	}
+      }
+
+      if (cupsFileClose(dstfp) || bytes < 0 || stat(dstname, &dstinfo))
+	ret = false;
+
+      if (!ret)
+      {
+	papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to compress document data: %s", strerror(errno));
+	unlink(dstname);
+      }
+    }
+    else
+    {
+      papplLogJob(job, PAPPL_LOGLEVEL_ERROR, "Unable to compress document data: %s", strerror(errno));
+      close(dstfd);
+      unlink(dstname);
+    }
+
+    close(srcfd);
+  }
+
+  // Replace the original file unless it was removed in the meantime, then
+  // apply the preserved bytes quota...
+  pthread_rwlock_wrlock(&printer->jobs_rwlock);
+  pthread_rwlock_wrlock(&job->rwlock);
+
+  if (ret && job->filename && !strcmp(job->filename, srcname) && (newname = strdup(dstname)) != NULL)
+  {
+    papplLogJob(job, PAPPL_LOGLEVEL_DEBUG, "Compressed document data to %ld bytes.", (long)dstinfo.st_size);
+
+    free(job->filename);
+    job->filename = newname;
+    job->filesize = dstinfo.st_size;
+
+    _papplJobUpdateMemory(job);
+
+    unlink(srcname);
+  }
+  else if (ret)
+  {
+    unlink(dstname);
+  }
+
+  job->compressing = false;
+
+  pthread_rwlock_unlock(&job->rwlock);
+
+  if (printer->max_preserved_bytes > 0)
+    _papplPrinterCleanJobsNoLock(printer);
+
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
+
+  // Let _papplPrinterWaitThreads know we are done - the job and printer must
+  // not be used after this point...
+  pthread_mutex_lock(&printer->threads_mutex);
+  printer->num_compressing --;
+  pthread_cond_broadcast(&printer->threads_cond);
+  pthread_mutex_unlock(&printer->threads_mutex);
+
+  return (NULL);
+}
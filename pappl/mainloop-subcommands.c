@@ -62,10 +62,14 @@ static bool	device_list_cb(const char *device_info, const char *device_uri, cons
 static void	free_printer(_pappl_ml_printer_t *p);
 static ipp_t	*get_printer_attributes(http_t *http, const char *printer_uri, const char *printer_name, const char *resource, cups_len_t num_requested, const char * const *requested);
 static char	*get_value(ipp_attribute_t *attr, const char *name, cups_len_t element, char *buffer, size_t bufsize);
+static void	print_jobs(http_t *http, const char *printer_uri, const char *printer_name, const char *resource, bool all, bool tsv);
 static void	print_option(ipp_t *response, const char *name);
+static void	print_printers(ipp_t *response, bool tsv);
+static void	print_status(const char *name, int state, time_t state_time, ipp_attribute_t *state_reasons, bool tsv);
 #if _WIN32
 static void	save_server_port(const char *base_name, int port);
 #endif // _WIN32
+static const char *tsv_string(const char *s, char *buffer, size_t bufsize);
 
 
 //
@@ -258,8 +262,8 @@ _papplMainloopCancelJob(
     }
   }
 
-  // Figure out which job(s) to cancel...
-  if (cupsGetOption("cancel-all", num_options, options))
+  // Figure out which job(s) to cancel ("cancel-all" is the old name of "all")...
+  if (cupsGetOption("all", num_options, options) || cupsGetOption("cancel-all", num_options, options))
   {
     request = ippNewRequest(IPP_OP_CANCEL_MY_JOBS);
   }
@@ -815,13 +819,11 @@ _papplMainloopRunServer(
     else
     {
       // Then run the UI stuff on the main thread (macOS limitation...)
-      while (!papplSystemIsRunning(system))
-	sleep(1);
+      papplSystemWaitRunning(system, true, 0);
 
       _papplSystemStatusUI(system);
 
-      while (papplSystemIsRunning(system))
-	sleep(1);
+      papplSystemWaitRunning(system, false, 0);
     }
   }
   else
@@ -932,27 +934,21 @@ _papplMainloopShowJobs(
     cups_option_t *options)		// I - Options
 {
   const char	*printer_uri,		// Printer URI
-		*printer_name;		// Printer name
+		*printer_name = NULL,	// Printer name
+		*value;			// Option value
   char		default_printer[256],	// Default printer
 		resource[1024];		// Resource path
   http_t	*http;			// Server connection
   ipp_t		*request,		// IPP request
 		*response;		// IPP response
   ipp_attribute_t *attr;		// Current attribute
-  const char	*attrname;		// Attribute name
-  int		job_id,			// Current job-id
-		job_state;		// Current job-state
-  const char	*job_name,		// Current job-name
-		*job_user;		// Current job-originating-user-name
-  static const char * const jattrs[] =	// Requested attributes
-  {
-    "job-id",
-    "job-name",
-    "job-originating-user-name",
-    "job-state"
-  };
+  bool		all,			// Show jobs for all printers?
+		tsv;			// Tab-separated output?
 
 
+  all = !cupsGetOption("printer-uri", num_options, options) && cupsGetOption("all", num_options, options) != NULL;
+  tsv = (value = cupsGetOption("output-format", num_options, options)) != NULL && !strcmp(value, "tsv");
+
   if ((printer_uri = cupsGetOption("printer-uri", num_options, options)) != NULL)
   {
     // Connect to the remote printer...
@@ -965,7 +961,7 @@ _papplMainloopShowJobs(
     if ((http = _papplMainloopConnect(base_name, true)) == NULL)
       return (1);
 
-    if ((printer_name = cupsGetOption("printer-name", num_options, options)) == NULL)
+    if (!all && (printer_name = cupsGetOption("printer-name", num_options, options)) == NULL)
     {
       if ((printer_name = _papplMainloopGetDefaultPrinter(http, default_printer, sizeof(default_printer))) == NULL)
       {
@@ -976,47 +972,27 @@ _papplMainloopShowJobs(
     }
   }
 
-  // Send a Get-Jobs request...
-  request = ippNewRequest(IPP_OP_GET_JOBS);
-  if (printer_uri)
-    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_URI, "printer-uri", NULL, printer_uri);
-  else
-    _papplMainloopAddPrinterURI(request, printer_name, resource, sizeof(resource));
-  ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_NAME, "requesting-user-name", NULL, cupsGetUser());
-  ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "which-jobs", NULL, "all");
-  ippAddStrings(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "requested-attributes", (int)(sizeof(jattrs) / sizeof(jattrs[0])), NULL, jattrs);
-
-  response = cupsDoRequest(http, request, resource);
-
-  for (attr = ippGetFirstAttribute(response); attr; attr = ippGetNextAttribute(response))
+  if (all)
   {
-    if (ippGetGroupTag(attr) == IPP_TAG_OPERATION)
-      continue;
-
-    job_id    = 0;
-    job_state = IPP_JSTATE_PENDING;
-    job_name  = "(none)";
-    job_user  = "(unknown)";
+    // Get the list of printers with a single request and then list the jobs
+    // for each printer over the same connection...
+    request = ippNewRequest(IPP_OP_GET_PRINTERS);
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_URI, "system-uri", NULL, "ipp://localhost/ipp/system");
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_NAME, "requesting-user-name", NULL, cupsGetUser());
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "requested-attributes", NULL, "printer-name");
 
-    while (ippGetGroupTag(attr) == IPP_TAG_JOB)
-    {
-      attrname = ippGetName(attr);
-      if (!strcmp(attrname, "job-id"))
-        job_id = ippGetInteger(attr, 0);
-      else if (!strcmp(attrname, "job-name"))
-        job_name = ippGetString(attr, 0, NULL);
-      else if (!strcmp(attrname, "job-originating-user-name"))
-        job_user = ippGetString(attr, 0, NULL);
-      else if (!strcmp(attrname, "job-state"))
-        job_state = ippGetInteger(attr, 0);
+    response = cupsDoRequest(http, request, "/ipp/system");
 
-      attr = ippGetNextAttribute(response);
-    }
+    for (attr = ippFindAttribute(response, "printer-name", IPP_TAG_NAME); attr; attr = ippFindNextAttribute(response, "printer-name", IPP_TAG_NAME))
+      print_jobs(http, NULL, ippGetString(attr, 0, NULL), NULL, true, tsv);
 
-    printf("%d %-12s %-16s %s\n", job_id, ippEnumString("job-state", job_state), job_user, job_name);
+    ippDelete(response);
+  }
+  else
+  {
+    print_jobs(http, printer_uri, printer_name, resource, false, tsv);
   }
 
-  ippDelete(response);
   httpClose(http);
 
   return (0);
@@ -1125,10 +1101,18 @@ _papplMainloopShowPrinters(
   ipp_t		*request,		// IPP request
 		*response;		// IPP response
   ipp_attribute_t *attr;		// Current attribute
+  const char	*value;			// Option value
+  bool		tsv;			// Tab-separated output?
+  static const char * const pattrs[] =
+  {					// Requested printer attributes
+      "printer-name",
+      "printer-state",
+      "printer-state-change-date-time",
+      "printer-state-reasons"
+  };
 
 
-  (void)num_options;
-  (void)options;
+  tsv = (value = cupsGetOption("output-format", num_options, options)) != NULL && !strcmp(value, "tsv");
 
   // Connect to/start up the server and get the list of printers...
   if ((http = _papplMainloopConnect(base_name, true)) == NULL)
@@ -1138,10 +1122,24 @@ _papplMainloopShowPrinters(
   ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_URI, "system-uri", NULL, "ipp://localhost/ipp/system");
   ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_NAME, "requesting-user-name", NULL, cupsGetUser());
 
+  // Only ask for the attributes we show, otherwise the server sends every
+  // attribute of every printer...
+  if (tsv)
+    ippAddStrings(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "requested-attributes", (int)(sizeof(pattrs) / sizeof(pattrs[0])), NULL, pattrs);
+  else
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "requested-attributes", NULL, "printer-name");
+
   response = cupsDoRequest(http, request, "/ipp/system");
 
-  for (attr = ippFindAttribute(response, "printer-name", IPP_TAG_NAME); attr; attr = ippFindNextAttribute(response, "printer-name", IPP_TAG_NAME))
-    puts(ippGetString(attr, 0, NULL));
+  if (tsv)
+  {
+    print_printers(response, true);
+  }
+  else
+  {
+    for (attr = ippFindAttribute(response, "printer-name", IPP_TAG_NAME); attr; attr = ippFindNextAttribute(response, "printer-name", IPP_TAG_NAME))
+      puts(ippGetString(attr, 0, NULL));
+  }
 
   ippDelete(response);
   httpClose(http);
@@ -1162,30 +1160,18 @@ _papplMainloopShowStatus(
 {
   http_t		*http;		// HTTP connection
   const char		*printer_uri,	// Printer URI
-			*printer_name;	// Printer name
+			*printer_name,	// Printer name
+			*value;		// Option value
   char			resource[1024];	// Resource path
   ipp_t			*request,	// IPP request
 			*response;	// IPP response
-  cups_len_t		i,		// Looping var
-			count;		// Number of reasons
   int			state;		// *-state value
   ipp_attribute_t	*state_reasons;	// *-state-reasons attribute
-  char			state_reasons_str[1024],
-					// *-state-reasons string
-			*state_reasons_ptr;
-					// Pointer into string
   time_t		state_time;	// *-state-change-time value
-  char			state_time_str[256];
-					// *-state-change-time date string
-  const char		*reason;	// *-state-reasons value
-  static const char * const states[] =	// *-state strings
-  {
-      "idle",
-      "processing jobs",
-      "stopped"
-  };
+  bool			tsv;		// Tab-separated output?
   static const char * const pattrs[] =
   {					// Requested printer attributes
+      "printer-name",
       "printer-state",
       "printer-state-change-date-time",
       "printer-state-reasons"
@@ -1203,8 +1189,6 @@ _papplMainloopShowStatus(
     // Connect to the remote printer...
     if ((http = _papplMainloopConnectURI(base_name, printer_uri, resource, sizeof(resource))) == NULL)
       return (1);
-
-    printer_name = NULL;
   }
   else
   {
@@ -1216,6 +1200,9 @@ _papplMainloopShowStatus(
     }
   }
 
+  tsv          = (value = cupsGetOption("output-format", num_options, options)) != NULL && !strcmp(value, "tsv");
+  printer_name = NULL;
+
   if (printer_uri || (printer_name = cupsGetOption("printer-name", num_options, options)) != NULL)
   {
     // Get the printer's status
@@ -1223,6 +1210,9 @@ _papplMainloopShowStatus(
     state         = ippGetInteger(ippFindAttribute(response, "printer-state", IPP_TAG_ENUM), 0);
     state_time    = ippDateToTime(ippGetDate(ippFindAttribute(response, "printer-state-change-date-time", IPP_TAG_DATE), 0));
     state_reasons = ippFindAttribute(response, "printer-state-reasons", IPP_TAG_KEYWORD);
+
+    if (tsv)
+      printer_name = ippGetString(ippFindAttribute(response, "printer-name", IPP_TAG_NAME), 0, NULL);
   }
   else
   {
@@ -1238,35 +1228,28 @@ _papplMainloopShowStatus(
     state_reasons = ippFindAttribute(response, "system-state-reasons", IPP_TAG_KEYWORD);
   }
 
-  if (state < IPP_PSTATE_IDLE)
-    state = IPP_PSTATE_IDLE;
-  else if (state > IPP_PSTATE_STOPPED)
-    state = IPP_PSTATE_STOPPED;
+  // Only tab-separated output includes the printer name, the "-d PRINTER"
+  // status is shown as "Running, ..." like the system status...
+  print_status(tsv ? printer_name : NULL, state, state_time, state_reasons, tsv);
 
-  state_reasons_str[0] = '\0';
+  ippDelete(response);
 
-  if (state_reasons)
+  if (!printer_uri && !printer_name && cupsGetOption("all", num_options, options))
   {
-    // Build a string with all of the reasons...
-    for (i = 0, count = ippGetCount(state_reasons), state_reasons_ptr = state_reasons_str; i < count; i ++)
-    {
-      reason = ippGetString(state_reasons, i, NULL);
+    // Get the status of all printers with a single request...
+    request = ippNewRequest(IPP_OP_GET_PRINTERS);
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_URI, "system-uri", NULL, "ipp://localhost/ipp/system");
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_NAME, "requesting-user-name", NULL, cupsGetUser());
+    ippAddStrings(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "requested-attributes", (int)(sizeof(pattrs) / sizeof(pattrs[0])), NULL, pattrs);
 
-      if (strcmp(reason, "none"))
-      {
-        if (state_reasons_ptr > state_reasons_str)
-          snprintf(state_reasons_ptr, sizeof(state_reasons_str) - (size_t)(state_reasons_ptr - state_reasons_str), ", %s", reason);
-	else
-	  papplCopyString(state_reasons_str, reason, sizeof(state_reasons_str));
+    response = cupsDoRequest(http, request, "/ipp/system");
 
-	state_reasons_ptr += strlen(state_reasons_ptr);
-      }
-    }
-  }
+    print_printers(response, tsv);
 
-  _papplLocPrintf(stdout, _PAPPL_LOC(/* Running, STATE since DATE REASONS */"Running, %s since %s%s."), states[state - IPP_PSTATE_IDLE], httpGetDateString(state_time, state_time_str, sizeof(state_time_str)), state_reasons_str);
+    ippDelete(response);
+  }
 
-  ippDelete(response);
+  httpClose(http);
 
   return (0);
 }
@@ -1983,6 +1966,103 @@ get_value(ipp_attribute_t *attr,	// I - Attribute
 }
 
 
+//
+// 'print_jobs()' - Print the jobs for a printer.
+//
+// Tab-separated output starts each line with the printer name or URI so the
+// output for multiple printers can be combined.
+//
+
+static void
+print_jobs(
+    http_t     *http,			// I - HTTP connection
+    const char *printer_uri,		// I - Printer URI, if any
+    const char *printer_name,		// I - Printer name, if any
+    const char *resource,		// I - Resource path
+    bool       all,			// I - Listing jobs for all printers?
+    bool       tsv)			// I - Tab-separated output?
+{
+  ipp_t		*request,		// IPP request
+		*response;		// IPP response
+  ipp_attribute_t *attr;		// Current attribute
+  const char	*attrname;		// Attribute name
+  char		temp[1024];		// Temporary resource path
+  int		job_id,			// Current job-id
+		job_state;		// Current job-state
+  const char	*job_name,		// Current job-name
+		*job_user;		// Current job-originating-user-name
+  char		tsv_name[1024],		// Escaped printer name or URI
+		tsv_user[256],		// Escaped job-originating-user-name
+		tsv_job[1024];		// Escaped job-name
+  static const char * const jattrs[] =	// Requested attributes
+  {
+    "job-id",
+    "job-name",
+    "job-originating-user-name",
+    "job-state"
+  };
+
+
+  // Send a Get-Jobs request...
+  request = ippNewRequest(IPP_OP_GET_JOBS);
+  if (printer_uri)
+  {
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_URI, "printer-uri", NULL, printer_uri);
+  }
+  else
+  {
+    _papplMainloopAddPrinterURI(request, printer_name, temp, sizeof(temp));
+    resource = temp;
+  }
+  ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_NAME, "requesting-user-name", NULL, cupsGetUser());
+  ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "which-jobs", NULL, "all");
+  ippAddStrings(request, IPP_TAG_OPERATION, IPP_TAG_KEYWORD, "requested-attributes", (int)(sizeof(jattrs) / sizeof(jattrs[0])), NULL, jattrs);
+
+  response = cupsDoRequest(http, request, resource);
+
+  for (attr = ippGetFirstAttribute(response); attr; attr = ippGetNextAttribute(response))
+  {
+    if (ippGetGroupTag(attr) == IPP_TAG_OPERATION)
+      continue;
+
+    job_id    = 0;
+    job_state = IPP_JSTATE_PENDING;
+    job_name  = "(none)";
+    job_user  = "(unknown)";
+
+    while (ippGetGroupTag(attr) == IPP_TAG_JOB)
+    {
+      attrname = ippGetName(attr);
+      if (!strcmp(attrname, "job-id"))
+        job_id = ippGetInteger(attr, 0);
+      else if (!strcmp(attrname, "job-name"))
+        job_name = ippGetString(attr, 0, NULL);
+      else if (!strcmp(attrname, "job-originating-user-name"))
+        job_user = ippGetString(attr, 0, NULL);
+      else if (!strcmp(attrname, "job-state"))
+        job_state = ippGetInteger(attr, 0);
+
+      attr = ippGetNextAttribute(response);
+    }
+
+    if (tsv)
+      printf("%s\t%d\t%s\t%s\t%s\n", tsv_string(printer_uri ? printer_uri : printer_name, tsv_name, sizeof(tsv_name)), job_id, ippEnumString("job-state", job_state), tsv_string(job_user, tsv_user, sizeof(tsv_user)), tsv_string(job_name, tsv_job, sizeof(tsv_job)));
+    else if (all)
+      printf("%s-%d %-12s %-16s %s\n", printer_name, job_id, ippEnumString("job-state", job_state), job_user, job_name);
+    else
+      printf("%d %-12s %-16s %s\n", job_id, ippEnumString("job-state", job_state), job_user, job_name);
+
+    if (!attr)
+      break;
+  }
+
+  ippDelete(response);
+
+  // Write the output for this printer before requesting the next one...
+  fflush(stdout);
+}
+
+
 //
 // 'print_option()' - Print the supported and default value for an option.
 //
@@ -2029,6 +2109,123 @@ print_option(ipp_t      *response,	// I - Get-Printer-Attributes response
 }
 
 
+//
+// 'print_printers()' - Print the status of each printer in a Get-Printers
+//                      response.
+//
+
+static void
+print_printers(ipp_t *response,		// I - Get-Printers response
+               bool  tsv)		// I - Tab-separated output?
+{
+  ipp_attribute_t *attr;		// Current attribute
+  const char	*attrname,		// Attribute name
+		*name;			// Printer name
+  int		state;			// "printer-state" value
+  time_t	state_time;		// "printer-state-change-date-time" value
+  ipp_attribute_t *state_reasons;	// "printer-state-reasons" attribute
+
+
+  for (attr = ippGetFirstAttribute(response); attr; attr = ippGetNextAttribute(response))
+  {
+    if (ippGetGroupTag(attr) != IPP_TAG_PRINTER)
+      continue;
+
+    name          = NULL;
+    state         = IPP_PSTATE_IDLE;
+    state_time    = 0;
+    state_reasons = NULL;
+
+    while (ippGetGroupTag(attr) == IPP_TAG_PRINTER)
+    {
+      attrname = ippGetName(attr);
+      if (!strcmp(attrname, "printer-name"))
+        name = ippGetString(attr, 0, NULL);
+      else if (!strcmp(attrname, "printer-state"))
+        state = ippGetInteger(attr, 0);
+      else if (!strcmp(attrname, "printer-state-change-date-time"))
+        state_time = ippDateToTime(ippGetDate(attr, 0));
+      else if (!strcmp(attrname, "printer-state-reasons"))
+        state_reasons = attr;
+
+      attr = ippGetNextAttribute(response);
+    }
+
+    if (name)
+      print_status(name, state, state_time, state_reasons, tsv);
+
+    if (!attr)
+      break;
+  }
+}
+
+
+//
+// 'print_status()' - Print the status of the system or a printer.
+//
+// Tab-separated output uses a single line with the escaped name (empty for
+// the system), state keyword, state change time in seconds since the epoch,
+// and a comma-delimited list of state reasons.
+//
+
+static void
+print_status(
+    const char      *name,		// I - Printer name or `NULL` for the system
+    int             state,		// I - "xxx-state" value
+    time_t          state_time,		// I - "xxx-state-change-date-time" value
+    ipp_attribute_t *state_reasons,	// I - "xxx-state-reasons" attribute
+    bool            tsv)		// I - Tab-separated output?
+{
+  cups_len_t	i,			// Looping var
+		count;			// Number of reasons
+  char		state_reasons_str[1024],// *-state-reasons string
+		*state_reasons_ptr;	// Pointer into string
+  char		state_time_str[256];	// *-state-change-time date string
+  char		tsv_name[1024];		// Escaped name
+  const char	*reason;		// *-state-reasons value
+  static const char * const states[] =	// *-state strings
+  {
+      "idle",
+      "processing jobs",
+      "stopped"
+  };
+
+
+  if (state < IPP_PSTATE_IDLE)
+    state = IPP_PSTATE_IDLE;
+  else if (state > IPP_PSTATE_STOPPED)
+    state = IPP_PSTATE_STOPPED;
+
+  state_reasons_str[0] = '\0';
+
+  if (state_reasons)
+  {
+    // Build a string with all of the reasons...
+    for (i = 0, count = ippGetCount(state_reasons), state_reasons_ptr = state_reasons_str; i < count; i ++)
+    {
+      reason = ippGetString(state_reasons, i, NULL);
+
+      if (strcmp(reason, "none"))
+      {
+        if (tsv && state_reasons_ptr == state_reasons_str)
+          papplCopyString(state_reasons_str, reason, sizeof(state_reasons_str));
+        else
+          snprintf(state_reasons_ptr, sizeof(state_reasons_str) - (size_t)(state_reasons_ptr - state_reasons_str), tsv ? ",%s" : ", %s", reason);
+
+	state_reasons_ptr += strlen(state_reasons_ptr);
+      }
+    }
+  }
+
+  if (tsv)
+    printf("%s\t%s\t%ld\t%s\n", tsv_string(name, tsv_name, sizeof(tsv_name)), ippEnumString("printer-state", state), (long)state_time, state_reasons_str[0] ? state_reasons_str : "none");
+  else if (name)
+    _papplLocPrintf(stdout, _PAPPL_LOC(/* PRINTER: STATE since DATE REASONS */"%s: %s since %s%s."), name, states[state - IPP_PSTATE_IDLE], httpGetDateString(state_time, state_time_str, sizeof(state_time_str)), state_reasons_str);
+  else
+    _papplLocPrintf(stdout, _PAPPL_LOC(/* Running, STATE since DATE REASONS */"Running, %s since %s%s."), states[state - IPP_PSTATE_IDLE], httpGetDateString(state_time, state_time_str, sizeof(state_time_str)), state_reasons_str);
+}
+
+
 #if _WIN32
 //
 // 'save_server_port()' - Save the port number we are using for the server in
@@ -2056,3 +2253,44 @@ save_server_port(const char *base_name,	// I - Base name of application
   }
 }
 #endif // _WIN32
+
+
+//
+// 'tsv_string()' - Escape a string for tab-separated output.
+//
+// Backslashes, tabs, and newlines are written as "\\", "\t", and "\n" so that
+// each record stays on one line with the expected number of fields.
+//
+
+static const char *			// O - Escaped string
+tsv_string(const char *s,		// I - String or `NULL` for none
+           char       *buffer,		// I - String buffer
+           size_t     bufsize)		// I - Size of string buffer
+{
+  char	*bufptr,			// Pointer into buffer
+	*bufend;			// End of buffer
+
+
+  if (!s)
+    s = "";
+
+  for (bufptr = buffer, bufend = buffer + bufsize - 1; *s && bufptr < bufend; s ++)
+  {
+    if (*s == '\\' || *s == '\t' || *s == '\n')
+    {
+      if (bufptr >= (bufend - 1))
+        break;
+
+      *bufptr++ = '\\';
+      *bufptr++ = *s == '\t' ? 't' : *s == '\n' ? 'n' : '\\';
+    }
+    else
+    {
+      *bufptr++ = *s;
+    }
+  }
+
+  *bufptr = '\0';
+
+  return (buffer);
+}
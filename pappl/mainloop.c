@@ -197,8 +197,8 @@ papplMainloop(
       {
 	switch (argv[i][1])
 	{
-          case 'a': // -a (cancel-all)
-              num_options = cupsAddOption("cancel-all", "true", num_options, &options);
+          case 'a': // -a (cancel all jobs or show all printers)
+              num_options = cupsAddOption("all", "true", num_options, &options);
               break;
 
           case 'd': // -d PRINTER
@@ -501,12 +501,13 @@ usage(const char *base_name,		// I - Base name of application
   _papplLocPrintf(stdout, _PAPPL_LOC("  submit           Submit a file for printing."));
   puts("");
   _papplLocPrintf(stdout, _PAPPL_LOC("Options:"));
-  _papplLocPrintf(stdout, _PAPPL_LOC("  -a               Cancel all jobs (cancel)."));
+  _papplLocPrintf(stdout, _PAPPL_LOC("  -a               Cancel all jobs (cancel) or show all printers (jobs,status)."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -d PRINTER       Specify printer."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -j JOB-ID        Specify job ID (cancel)."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -m DRIVER-NAME   Specify driver (add/modify)."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -n COPIES        Specify number of copies (submit)."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -o NAME=VALUE    Specify option (add,modify,server,submit)."));
+  _papplLocPrintf(stdout, _PAPPL_LOC("                   Use output-format=tsv for tab-separated output (jobs,printers,status)."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -u URI           Specify ipp: or ipps: printer/server."));
   _papplLocPrintf(stdout, _PAPPL_LOC("  -v DEVICE-URI    Specify socket: or usb: device (add/modify)."));
 }
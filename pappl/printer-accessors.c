@@ -33,7 +33,7 @@ papplPrinterCloseDevice(
 
   printer->device_in_use = false;
 
-  if (cupsArrayGetCount(printer->active_jobs) > 0 && !printer->processing_job)
+  if (papplPrinterGetNumberOfActiveJobs(printer) > 0 && !printer->processing_job)
     _papplPrinterCheckJobs(printer);
 
   if (printer->state != IPP_PSTATE_PROCESSING)
@@ -48,6 +48,9 @@ papplPrinterCloseDevice(
 
     pthread_rwlock_unlock(&printer->rwlock);
   }
+
+  // Wake up any job that is waiting for the device...
+  _papplPrinterWakeDevice(printer);
 }
 
 
@@ -297,6 +300,23 @@ papplPrinterGetMaxCompletedJobs(
 }
 
 
+//
+// 'papplPrinterGetMaxPreservedBytes()' - Get the maximum number of bytes of
+//                                        preserved document data.
+//
+// This function returns the maximum number of bytes of document data that are
+// retained for preserved jobs as configured by the
+// @link papplPrinterSetMaxPreservedBytes@ function.
+//
+
+size_t					// O - Maximum bytes of preserved document data, `0` for unlimited
+papplPrinterGetMaxPreservedBytes(
+    pappl_printer_t *printer)		// I - Printer
+{
+  return (printer ? printer->max_preserved_bytes : 0);
+}
+
+
 //
 // 'papplPrinterGetMaxPreservedJobs()' - Get the maximum number of jobs
 //                                       preserved by the printer.
@@ -340,7 +360,7 @@ int					// O - Next job ID or `0` for none
 papplPrinterGetNextJobID(
     pappl_printer_t *printer)		// I - Printer
 {
-  return (printer ? printer->next_job_id : 0);
+  return (printer ? _PAPPL_ATOMIC_GET(&printer->next_job_id) : 0);
 }
 
 
@@ -355,7 +375,17 @@ int					// O - Number of active print jobs
 papplPrinterGetNumberOfActiveJobs(
     pappl_printer_t *printer)		// I - Printer
 {
-  return (printer ? (int)cupsArrayGetCount(printer->active_jobs) : 0);
+  int	count = 0;			// Number of active jobs
+
+
+  if (printer)
+  {
+    pthread_rwlock_rdlock(&printer->jobs_rwlock);
+    count = (int)cupsArrayGetCount(printer->active_jobs);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
+  }
+
+  return (count);
 }
 
 
@@ -371,7 +401,17 @@ int					// O - Number of completed print jobs
 papplPrinterGetNumberOfCompletedJobs(
     pappl_printer_t *printer)		// I - Printer
 {
-  return (printer ? (int)cupsArrayGetCount(printer->completed_jobs) : 0);
+  int	count = 0;			// Number of completed jobs
+
+
+  if (printer)
+  {
+    pthread_rwlock_rdlock(&printer->jobs_rwlock);
+    count = (int)cupsArrayGetCount(printer->completed_jobs);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
+  }
+
+  return (count);
 }
 
 
@@ -386,7 +426,17 @@ int					// O - Total number of print jobs
 papplPrinterGetNumberOfJobs(
     pappl_printer_t *printer)		// I - Printer
 {
-  return (printer ? (int)cupsArrayGetCount(printer->all_jobs) : 0);
+  int	count = 0;			// Number of jobs
+
+
+  if (printer)
+  {
+    pthread_rwlock_rdlock(&printer->jobs_rwlock);
+    count = (int)cupsArrayGetCount(printer->all_jobs);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
+  }
+
+  return (count);
 }
 
 
@@ -654,7 +704,7 @@ papplPrinterIterateActiveJobs(
   if (!printer || !cb)
     return;
 
-  pthread_rwlock_rdlock(&printer->rwlock);
+  pthread_rwlock_rdlock(&printer->jobs_rwlock);
 
   // Note: Cannot use cupsArrayGetFirst/Last since other threads might be
   // enumerating the active_jobs array.
@@ -669,7 +719,7 @@ papplPrinterIterateActiveJobs(
     (cb)(job, data);
   }
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
 }
 
 
@@ -701,7 +751,7 @@ papplPrinterIterateAllJobs(
   if (!printer || !cb)
     return;
 
-  pthread_rwlock_rdlock(&printer->rwlock);
+  pthread_rwlock_rdlock(&printer->jobs_rwlock);
 
   // Note: Cannot use cupsArrayGetFirst/Last since other threads might be
   // enumerating the all_jobs array.
@@ -716,7 +766,7 @@ papplPrinterIterateAllJobs(
     (cb)(job, data);
   }
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
 }
 
 
@@ -749,7 +799,7 @@ papplPrinterIterateCompletedJobs(
   if (!printer || !cb)
     return;
 
-  pthread_rwlock_rdlock(&printer->rwlock);
+  pthread_rwlock_rdlock(&printer->jobs_rwlock);
 
   // Note: Cannot use cupsArrayGetFirst/Last since other threads might be
   // enumerating the completed_jobs array.
@@ -764,7 +814,7 @@ papplPrinterIterateCompletedJobs(
     (cb)(job, data);
   }
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
 }
 
 
@@ -821,9 +871,15 @@ papplPrinterPause(
   pthread_rwlock_wrlock(&printer->rwlock);
 
   if (printer->processing_job)
+  {
     printer->is_stopped = true;
-  else
-    printer->state = IPP_PSTATE_STOPPED;
+  }
+  else if (printer->state != IPP_PSTATE_STOPPED)
+  {
+    printer->state      = IPP_PSTATE_STOPPED;
+    printer->state_time = time(NULL);
+    printer->state_changes ++;
+  }
 
   _papplSystemAddEventNoLock(printer->system, printer, NULL, PAPPL_EVENT_PRINTER_STATE_CHANGED | PAPPL_EVENT_PRINTER_STOPPED, NULL);
 
@@ -847,7 +903,13 @@ papplPrinterResume(
   pthread_rwlock_wrlock(&printer->rwlock);
 
   printer->is_stopped = false;
-  printer->state      = IPP_PSTATE_IDLE;
+
+  if (printer->state != IPP_PSTATE_IDLE)
+  {
+    printer->state      = IPP_PSTATE_IDLE;
+    printer->state_time = time(NULL);
+    printer->state_changes ++;
+  }
 
   _papplSystemAddEventNoLock(printer->system, printer, NULL, PAPPL_EVENT_PRINTER_STATE_CHANGED, NULL);
 
@@ -1065,6 +1127,35 @@ papplPrinterSetMaxCompletedJobs(
 }
 
 
+//
+// 'papplPrinterSetMaxPreservedBytes()' - Set the maximum number of bytes of
+//                                        preserved document data.
+//
+// This function sets the maximum number of bytes of (compressed) document data
+// that are retained for preserved jobs.  When the limit is exceeded, the
+// document data of the oldest preserved jobs is removed first.  A value of `0`
+// removes the limit.
+//
+
+void
+papplPrinterSetMaxPreservedBytes(
+    pappl_printer_t *printer,		// I - Printer
+    size_t          max_preserved_bytes)// I - Maximum bytes of preserved document data, `0` for unlimited
+{
+  if (!printer)
+    return;
+
+  pthread_rwlock_wrlock(&printer->rwlock);
+
+  printer->max_preserved_bytes = max_preserved_bytes;
+  printer->config_time         = time(NULL);
+
+  pthread_rwlock_unlock(&printer->rwlock);
+
+  _papplSystemConfigChanged(printer->system);
+}
+
+
 //
 // 'papplPrinterSetMaxPreservedJobs()' - Set the maximum number of preserved
 //                                       jobs for the printer.
@@ -1112,7 +1203,7 @@ papplPrinterSetNextJobID(
 
   pthread_rwlock_wrlock(&printer->rwlock);
 
-  printer->next_job_id = next_job_id;
+  _PAPPL_ATOMIC_SET(&printer->next_job_id, next_job_id);
   printer->config_time = time(NULL);
 
   pthread_rwlock_unlock(&printer->rwlock);
@@ -1236,14 +1327,26 @@ papplPrinterSetReasons(
     pappl_preason_t add,		// I - "printer-state-reasons" bit values to add or `PAPPL_PREASON_NONE` for none
     pappl_preason_t remove)		// I - "printer-state-reasons" bit values to remove or `PAPPL_PREASON_NONE` for none
 {
+  pappl_preason_t	reasons;	// New "printer-state-reasons" values
+
+
   if (!printer)
     return;
 
   pthread_rwlock_wrlock(&printer->rwlock);
 
-  printer->state_reasons &= ~remove;
-  printer->state_reasons |= add;
-  printer->state_time    = printer->status_time = time(NULL);
+  reasons              = (printer->state_reasons & ~remove) | add;
+  printer->status_time = time(NULL);
+
+  if (reasons != printer->state_reasons)
+  {
+    // Only report actual changes...
+    printer->state_reasons = reasons;
+    printer->state_time    = printer->status_time;
+    printer->reasons_changes ++;
+
+    _papplSystemAddEventNoLock(printer->system, printer, NULL, PAPPL_EVENT_PRINTER_STATE_CHANGED, "Printer state reasons changed.");
+  }
 
   pthread_rwlock_unlock(&printer->rwlock);
 }
@@ -1261,16 +1364,45 @@ papplPrinterSetSupplies(
     int             num_supplies,	// I - Number of supplies
     pappl_supply_t  *supplies)		// I - Array of supplies
 {
+  int		i;			// Looping var
+  pappl_event_t	event = PAPPL_EVENT_NONE;
+					// Event(s) to report
+
+
   if (!printer || num_supplies < 0 || num_supplies > PAPPL_MAX_SUPPLY || (num_supplies > 0 && !supplies))
     return;
 
   pthread_rwlock_wrlock(&printer->rwlock);
 
-  printer->num_supply = num_supplies;
-  memset(printer->supply, 0, sizeof(printer->supply));
-  if (supplies)
-    memcpy(printer->supply, supplies, (size_t)num_supplies * sizeof(pappl_supply_t));
-  printer->state_time = time(NULL);
+  // Compare against the current supplies so that only actual changes are
+  // reported...
+  if (num_supplies != printer->num_supply)
+  {
+    event = PAPPL_EVENT_PRINTER_CONFIG_CHANGED | PAPPL_EVENT_PRINTER_STATE_CHANGED;
+  }
+  else
+  {
+    for (i = 0; i < num_supplies; i ++)
+    {
+      if (supplies[i].color != printer->supply[i].color || supplies[i].type != printer->supply[i].type || supplies[i].is_consumed != printer->supply[i].is_consumed || strcmp(supplies[i].description, printer->supply[i].description))
+        event |= PAPPL_EVENT_PRINTER_CONFIG_CHANGED;
+
+      if (supplies[i].level != printer->supply[i].level)
+        event |= PAPPL_EVENT_PRINTER_STATE_CHANGED;
+    }
+  }
+
+  if (event != PAPPL_EVENT_NONE)
+  {
+    printer->num_supply = num_supplies;
+    memset(printer->supply, 0, sizeof(printer->supply));
+    if (supplies)
+      memcpy(printer->supply, supplies, (size_t)num_supplies * sizeof(pappl_supply_t));
+    printer->state_time = time(NULL);
+    printer->supply_changes ++;
+
+    _papplSystemAddEventNoLock(printer->system, printer, NULL, event, "Printer supplies changed.");
+  }
 
   pthread_rwlock_unlock(&printer->rwlock);
 }
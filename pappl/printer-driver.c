@@ -19,12 +19,125 @@
 // Local functions...
 //
 
+static int	compare_media(_pappl_media_size_t *a, _pappl_media_size_t *b);
 static ipp_t	*make_attrs(pappl_system_t *system, pappl_printer_t *printer, pappl_pr_driver_data_t *data);
 static bool	validate_defaults(pappl_printer_t *printer, pappl_pr_driver_data_t *driver_data, pappl_pr_driver_data_t *data);
 static bool	validate_driver(pappl_printer_t *printer, pappl_pr_driver_data_t *data);
 static bool	validate_ready(pappl_printer_t *printer, pappl_pr_driver_data_t *driver_data, int num_ready, pappl_media_col_t *ready);
 
 
+//
+// '_papplPrinterFindMedia()' - Find a media size by name.
+//
+// This function looks up the named size in the printer's media cache and
+// falls back on `pwgMediaForPWG` for sizes the driver does not list.  The
+// printer must be locked by the caller when "printer" is not `NULL`.
+//
+
+pwg_media_t *				// O - PWG media information or `NULL` if unknown
+_papplPrinterFindMedia(
+    pappl_printer_t *printer,		// I - Printer or `NULL`
+    const char      *size_name)		// I - PWG media size name
+{
+  _pappl_media_size_t	key,		// Search key
+			*match;		// Matching size
+
+
+  if (!size_name)
+    return (NULL);
+
+  if (printer && printer->num_media_sizes > 0)
+  {
+    papplCopyString(key.name, size_name, sizeof(key.name));
+
+    if ((match = (_pappl_media_size_t *)bsearch(&key, printer->media_sizes, (size_t)printer->num_media_sizes, sizeof(_pappl_media_size_t), (int (*)(const void *, const void *))compare_media)) != NULL)
+      return (&match->pwg);
+  }
+
+  return (pwgMediaForPWG(size_name));
+}
+
+
+//
+// '_papplPrinterFindMediaForSize()' - Find a media size by dimensions.
+//
+// This function looks for an exact match in the printer's media cache and
+// falls back on `pwgMediaForSize`.  The printer must be locked by the caller
+// when "printer" is not `NULL`.
+//
+
+pwg_media_t *				// O - PWG media information or `NULL` if unknown
+_papplPrinterFindMediaForSize(
+    pappl_printer_t *printer,		// I - Printer or `NULL`
+    int             width,		// I - Width in hundredths of millimeters
+    int             length)		// I - Length in hundredths of millimeters
+{
+  int			i;		// Looping var
+  _pappl_media_size_t	*size;		// Current size
+
+
+  if (printer)
+  {
+    for (i = printer->num_media_sizes, size = printer->media_sizes; i > 0; i --, size ++)
+    {
+      if (size->pwg.width == width && size->pwg.length == length)
+        return (&size->pwg);
+    }
+  }
+
+  return (pwgMediaForSize(width, length));
+}
+
+
+//
+// 'papplPrinterGetDriverAttributeString()' - Get the value of a driver
+//                                            attribute as a string.
+//
+// This function looks up a single driver attribute and copies its value(s)
+// as a string to the buffer pointed to by the "buffer" argument, without
+// copying the rest of the driver attributes.  Multiple values are separated by
+// commas, and collection values use the `ippAttributeString` format.
+//
+// The "version" argument, if not `NULL`, receives a number that changes
+// whenever the driver attributes change, which allows callers to cache values
+// they derive from the attributes.
+//
+// @since PAPPL 1.3@
+//
+
+char *					// O - Attribute value or `NULL` if not found
+papplPrinterGetDriverAttributeString(
+    pappl_printer_t *printer,		// I - Printer
+    const char      *name,		// I - Attribute name
+    char            *buffer,		// I - String buffer
+    size_t          bufsize,		// I - Size of string buffer
+    unsigned        *version)		// O - Driver attributes version or `NULL`
+{
+  ipp_attribute_t	*attr;		// Attribute
+
+
+  if (buffer)
+    *buffer = '\0';
+  if (version)
+    *version = 0;
+
+  if (!printer || !name || !buffer || bufsize == 0)
+    return (NULL);
+
+  pthread_rwlock_rdlock(&printer->rwlock);
+
+  if ((attr = ippFindAttribute(printer->driver_attrs, name, IPP_TAG_ZERO)) != NULL)
+    ippAttributeString(attr, buffer, bufsize);
+
+  if (version)
+    *version = printer->driver_version;
+
+  pthread_rwlock_unlock(&printer->rwlock);
+
+  return (attr ? buffer : NULL);
+}
+
+
 //
 // 'papplPrinterGetDriverAttributes()' - Get a copy of the current driver
 //                                       attributes.
@@ -33,6 +146,9 @@ static bool	validate_ready(pappl_printer_t *printer, pappl_pr_driver_data_t *dri
 // `ippDelete` function to free the memory used for the attributes when you
 // are done.
 //
+// > Note: Use the @link papplPrinterGetDriverAttributeString@ function to look
+// > at a few attributes without copying all of them.
+//
 
 ipp_t *					// O - Copy of driver attributes
 papplPrinterGetDriverAttributes(
@@ -196,6 +312,10 @@ papplPrinterSetDriverData(
   if (attrs)
     ippCopyAttributes(printer->driver_attrs, attrs, 0, NULL, NULL);
 
+  printer->driver_version ++;
+
+  _papplPrinterUpdateMediaNoLock(printer);
+
   pthread_rwlock_unlock(&printer->rwlock);
 
   return (true);
@@ -296,6 +416,9 @@ papplPrinterSetDriverDefaults(
   }
 
   printer->config_time = time(NULL);
+  printer->driver_version ++;
+
+  _papplPrinterUpdateMediaNoLock(printer);
 
   pthread_rwlock_unlock(&printer->rwlock);
 
@@ -348,6 +471,8 @@ papplPrinterSetReadyMedia(
 
   printer->state_time = time(NULL);
 
+  _papplPrinterUpdateMediaNoLock(printer);
+
   pthread_rwlock_unlock(&printer->rwlock);
 
   _papplSystemConfigChanged(printer->system);
@@ -356,6 +481,167 @@ papplPrinterSetReadyMedia(
 }
 
 
+//
+// '_papplPrinterUpdateMediaNoLock()' - Update the cached media information.
+//
+// This function rebuilds the media size cache and the "media-col-default" and
+// "media-col-ready" values from the current driver data.  The printer must be
+// locked for writing by the caller.
+//
+
+void
+_papplPrinterUpdateMediaNoLock(
+    pappl_printer_t *printer)		// I - Printer
+{
+  pappl_pr_driver_data_t *data = &printer->driver_data;
+					// Driver data
+  int			i, j,		// Looping vars
+			count,		// Number of values
+			num_names = 0;	// Number of media names
+  const char		*names[PAPPL_MAX_MEDIA + PAPPL_MAX_SOURCE + 1];
+					// Media names
+  pwg_media_t		*pwg;		// PWG media information
+  _pappl_media_size_t	*size;		// Current cached size
+  ipp_t			*col;		// Collection value
+  ipp_attribute_t	*attr;		// media-col-ready attribute
+  pappl_media_col_t	media;		// Current media...
+  bool			borderless;	// Report borderless media, too?
+
+
+  // Free the old cache...
+  free(printer->media_sizes);
+  ippDelete(printer->media_attrs);
+
+  printer->media_sizes     = NULL;
+  printer->num_media_sizes = 0;
+  printer->media_attrs     = NULL;
+
+  // Cache the sizes the driver lists, loads, or uses by default...
+  for (i = 0; i < data->num_media && i < PAPPL_MAX_MEDIA; i ++)
+    names[num_names ++] = data->media[i];
+
+  for (i = 0; i < data->num_source && i < PAPPL_MAX_SOURCE; i ++)
+  {
+    if (data->media_ready[i].size_name[0])
+      names[num_names ++] = data->media_ready[i].size_name;
+  }
+
+  if (data->media_default.size_name[0])
+    names[num_names ++] = data->media_default.size_name;
+
+  if (num_names > 0 && (printer->media_sizes = (_pappl_media_size_t *)calloc((size_t)num_names, sizeof(_pappl_media_size_t))) != NULL)
+  {
+    for (i = 0; i < num_names; i ++)
+    {
+      for (j = 0; j < printer->num_media_sizes; j ++)
+      {
+        if (!strcmp(names[i], printer->media_sizes[j].name))
+          break;
+      }
+
+      if (j < printer->num_media_sizes || (pwg = pwgMediaForPWG(names[i])) == NULL)
+        continue;
+
+      // Copy the strings since pwgMediaForPWG can return per-thread storage
+      // for custom sizes...
+      size = printer->media_sizes + printer->num_media_sizes;
+
+      papplCopyString(size->name, names[i], sizeof(size->name));
+      if (pwg->legacy)
+        papplCopyString(size->legacy, pwg->legacy, sizeof(size->legacy));
+      if (pwg->ppd)
+        papplCopyString(size->ppd, pwg->ppd, sizeof(size->ppd));
+
+      size->pwg.width  = pwg->width;
+      size->pwg.length = pwg->length;
+
+      printer->num_media_sizes ++;
+    }
+
+    qsort(printer->media_sizes, (size_t)printer->num_media_sizes, sizeof(_pappl_media_size_t), (int (*)(const void *, const void *))compare_media);
+
+    // Point the PWG media strings at the cached copies (after sorting)...
+    for (i = printer->num_media_sizes, size = printer->media_sizes; i > 0; i --, size ++)
+    {
+      size->pwg.pwg    = size->name;
+      size->pwg.legacy = size->legacy[0] ? size->legacy : NULL;
+      size->pwg.ppd    = size->ppd[0] ? size->ppd : NULL;
+    }
+  }
+
+  // Build the media-col-default and media-col-ready values...
+  printer->media_attrs = ippNew();
+
+  if (data->media_default.size_name[0] && (col = _papplMediaColExport(data, &data->media_default, false)) != NULL)
+  {
+    ippAddCollection(printer->media_attrs, IPP_TAG_PRINTER, "media-col-default", col);
+    ippDelete(col);
+  }
+
+  for (i = 0, count = 0; i < printer->num_ready; i ++)
+  {
+    if (data->media_ready[i].size_name[0])
+      count ++;
+  }
+
+  borderless = data->borderless && (data->bottom_top != 0 || data->left_right != 0);
+
+  if (borderless)
+    count *= 2;				// Need to report ready media for borderless, too...
+
+  if (count > 0)
+  {
+    attr = ippAddCollections(printer->media_attrs, IPP_TAG_PRINTER, "media-col-ready", IPP_NUM_CAST count, NULL);
+
+    for (i = 0, j = 0; i < printer->num_ready && j < count; i ++)
+    {
+      if (!data->media_ready[i].size_name[0])
+        continue;
+
+      if (borderless)
+      {
+	// Report both bordered and borderless media-col values...
+	media = data->media_ready[i];
+
+	media.bottom_margin = media.top_margin   = data->bottom_top;
+	media.left_margin   = media.right_margin = data->left_right;
+	col = _papplMediaColExport(data, &media, false);
+	ippSetCollection(printer->media_attrs, &attr, IPP_NUM_CAST j ++, col);
+	ippDelete(col);
+
+	media.bottom_margin = media.top_margin   = 0;
+	media.left_margin   = media.right_margin = 0;
+	col = _papplMediaColExport(data, &media, false);
+	ippSetCollection(printer->media_attrs, &attr, IPP_NUM_CAST j ++, col);
+	ippDelete(col);
+      }
+      else
+      {
+	// Just report the single media-col value...
+	col = _papplMediaColExport(data, data->media_ready + i, false);
+	ippSetCollection(printer->media_attrs, &attr, IPP_NUM_CAST j ++, col);
+	ippDelete(col);
+      }
+    }
+  }
+
+  // Update memory accounting for the printer, driver, and media attributes...
+  _papplSystemUpdateMemory(printer->system, PAPPL_MEMORY_PRINTER_ATTRS, &printer->memused, sizeof(pappl_printer_t) + ippLength(printer->attrs) + ippLength(printer->driver_attrs) + ippLength(printer->media_attrs) + (size_t)printer->num_media_sizes * sizeof(_pappl_media_size_t));
+}
+
+
+//
+// 'compare_media()' - Compare two cached media sizes by name.
+//
+
+static int				// O - Result of comparison
+compare_media(_pappl_media_size_t *a,	// I - First media size
+              _pappl_media_size_t *b)	// I - Second media size
+{
+  return (strcmp(a->name, b->name));
+}
+
+
 //
 // 'make_attrs()' - Make the capability attributes for the given driver data.
 //
@@ -53,6 +53,9 @@ static bool		valid_job_attributes(pappl_client_t *client);
 //
 // '_papplPrinterCopyAttributes()' - Copy printer attributes to a response...
 //
+// The caller must hold read locks on the printer's job arrays and the printer,
+// in that order.
+//
 
 void
 _papplPrinterCopyAttributes(
@@ -160,68 +163,7 @@ _papplPrinterCopyAttributes(
     }
   }
 
-  if ((!ra || cupsArrayFind(ra, "media-col-default")) && data->media_default.size_name[0])
-  {
-    ipp_t *col = _papplMediaColExport(&printer->driver_data, &data->media_default, 0);
-					// Collection value
-
-    ippAddCollection(client->response, IPP_TAG_PRINTER, "media-col-default", col);
-    ippDelete(col);
-  }
-
-  if (!ra || cupsArrayFind(ra, "media-col-ready"))
-  {
-    cups_len_t		j,		// Looping var
-			count;		// Number of values
-    ipp_t		*col;		// Collection value
-    ipp_attribute_t	*attr;		// media-col-ready attribute
-    pappl_media_col_t	media;		// Current media...
-
-    for (i = 0, count = 0; i < (cups_len_t)printer->num_ready; i ++)
-    {
-      if (data->media_ready[i].size_name[0])
-        count ++;
-    }
-
-    if (data->borderless && (data->bottom_top != 0 || data->left_right != 0))
-      count *= 2;			// Need to report ready media for borderless, too...
-
-    if (count > 0)
-    {
-      attr = ippAddCollections(client->response, IPP_TAG_PRINTER, "media-col-ready", IPP_NUM_CAST count, NULL);
-
-      for (i = 0, j = 0; i < (cups_len_t)printer->num_ready && j < count; i ++)
-      {
-	if (data->media_ready[i].size_name[0])
-	{
-          if (data->borderless && (data->bottom_top != 0 || data->left_right != 0))
-	  {
-	    // Report both bordered and borderless media-col values...
-	    media = data->media_ready[i];
-
-	    media.bottom_margin = media.top_margin   = data->bottom_top;
-	    media.left_margin   = media.right_margin = data->left_right;
-	    col = _papplMediaColExport(&printer->driver_data, &media, 0);
-	    ippSetCollection(client->response, &attr, IPP_NUM_CAST j ++, col);
-	    ippDelete(col);
-
-	    media.bottom_margin = media.top_margin   = 0;
-	    media.left_margin   = media.right_margin = 0;
-	    col = _papplMediaColExport(&printer->driver_data, &media, 0);
-	    ippSetCollection(client->response, &attr, IPP_NUM_CAST j ++, col);
-	    ippDelete(col);
-	  }
-	  else
-	  {
-	    // Just report the single media-col value...
-	    col = _papplMediaColExport(&printer->driver_data, data->media_ready + i, 0);
-	    ippSetCollection(client->response, &attr, IPP_NUM_CAST j ++, col);
-	    ippDelete(col);
-	  }
-	}
-      }
-    }
-  }
+  _papplCopyAttributes(client->response, printer->media_attrs, ra, IPP_TAG_ZERO, 0);
 
   if ((!ra || cupsArrayFind(ra, "media-default")) && data->media_default.size_name[0])
     ippAddString(client->response, IPP_TAG_PRINTER, IPP_TAG_KEYWORD, "media-default", NULL, data->media_default.size_name);
@@ -434,7 +376,7 @@ _papplPrinterCopyAttributes(
 
   if (!ra || cupsArrayFind(ra, "printer-strings-uri"))
   {
-    const char	*lang = ippGetString(ippFindAttribute(client->request, "attributes-natural-language", IPP_TAG_LANGUAGE), 0, NULL);
+    const char	*lang = ippGetString(_papplClientFindAttribute(client, "attributes-natural-language", IPP_TAG_LANGUAGE), 0, NULL);
 					// Language
     char	baselang[3],		// Base language
 		uri[1024];		// Strings file URI
@@ -533,7 +475,7 @@ _papplPrinterCopyAttributes(
     // Get Wi-Fi status...
     pappl_wifi_t	wifi;		// Wi-Fi status
 
-    if ((client->system->wifi_status_cb)(client->system, client->system->wifi_cbdata, &wifi))
+    if (_papplSystemGetWiFiStatus(client->system, &wifi))
     {
       if (!ra || cupsArrayFind(ra, "printer-wifi-ssid"))
         ippAddString(client->response, IPP_TAG_PRINTER, IPP_TAG_NAME, "printer-wifi-ssid", NULL, wifi.ssid);
@@ -633,7 +575,7 @@ _papplPrinterCopyState(
     {
       pappl_wifi_t	wifi;		// Wi-Fi status
 
-      if ((client->system->wifi_status_cb)(client->system, client->system->wifi_cbdata, &wifi))
+      if (_papplSystemGetWiFiStatus(client->system, &wifi))
       {
         if (wifi.state == PAPPL_WIFI_STATE_NOT_CONFIGURED)
           wifi_not_configured = true;
@@ -1010,7 +952,7 @@ _papplPrinterSetAttributes(
     }
     else if (!strcmp(name, "media-col-default"))
     {
-      _papplMediaColImport(ippGetCollection(rattr, 0), &driver_data.media_default);
+      _papplMediaColImport(NULL, ippGetCollection(rattr, 0), &driver_data.media_default);
       do_defaults = true;
     }
     else if (!strcmp(name, "media-col-ready"))
@@ -1018,7 +960,7 @@ _papplPrinterSetAttributes(
       count = ippGetCount(rattr);
 
       for (i = 0; i < count; i ++)
-        _papplMediaColImport(ippGetCollection(rattr, i), driver_data.media_ready + i);
+        _papplMediaColImport(NULL, ippGetCollection(rattr, i), driver_data.media_ready + i);
 
       for (; i < PAPPL_MAX_SOURCE; i ++)
         memset(driver_data.media_ready + i, 0, sizeof(pappl_media_col_t));
@@ -1179,7 +1121,12 @@ _papplPrinterSetAttributes(
 
   if (do_wifi)
   {
-    if (!(printer->system->wifi_join_cb)(printer->system, printer->system->wifi_cbdata, wifi_ssid, wifi_password))
+    bool joined = (printer->system->wifi_join_cb)(printer->system, printer->system->wifi_cbdata, wifi_ssid, wifi_password);
+					// Did we join the network?
+
+    papplSystemSetWiFiStatus(printer->system, NULL);
+
+    if (!joined)
     {
       papplClientRespondIPP(client, IPP_STATUS_ERROR_ATTRIBUTES_OR_VALUES, "Unable to join Wi-Fi network '%s'.", wifi_ssid);
       return (false);
@@ -1224,12 +1171,12 @@ create_job(
   // Get the requesting-user-name, document format, and name...
   if (client->username[0])
     username = client->username;
-  else  if ((attr = ippFindAttribute(client->request, "requesting-user-name", IPP_TAG_NAME)) != NULL)
+  else  if ((attr = _papplClientFindAttribute(client, "requesting-user-name", IPP_TAG_NAME)) != NULL)
     username = ippGetString(attr, 0, NULL);
   else
     username = "guest";
 
-  if ((attr = ippFindAttribute(client->request, "job-name", IPP_TAG_NAME)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "job-name", IPP_TAG_NAME)) != NULL)
     job_name = ippGetString(attr, 0, NULL);
   else
     job_name = "Untitled";
@@ -1426,7 +1373,7 @@ ipp_get_jobs(pappl_client_t *client)	// I - Client
     return;
 
   // See if the "which-jobs" attribute have been specified...
-  if ((attr = ippFindAttribute(client->request, "which-jobs", IPP_TAG_KEYWORD)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "which-jobs", IPP_TAG_KEYWORD)) != NULL)
   {
     which_jobs = ippGetString(attr, 0, NULL);
     papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Get-Jobs \"which-jobs\"='%s'", which_jobs);
@@ -1458,7 +1405,7 @@ ipp_get_jobs(pappl_client_t *client)	// I - Client
   }
 
   // See if they want to limit the number of jobs reported...
-  if ((attr = ippFindAttribute(client->request, "limit", IPP_TAG_INTEGER)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "limit", IPP_TAG_INTEGER)) != NULL)
   {
     int temp = ippGetInteger(attr, 0);
 
@@ -1474,7 +1421,7 @@ ipp_get_jobs(pappl_client_t *client)	// I - Client
   // See if we only want to see jobs for a specific user...
   username = NULL;
 
-  if ((attr = ippFindAttribute(client->request, "my-jobs", IPP_TAG_BOOLEAN)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "my-jobs", IPP_TAG_BOOLEAN)) != NULL)
   {
     int my_jobs = ippGetBoolean(attr, 0);
 
@@ -1482,7 +1429,7 @@ ipp_get_jobs(pappl_client_t *client)	// I - Client
 
     if (my_jobs)
     {
-      if ((attr = ippFindAttribute(client->request, "requesting-user-name", IPP_TAG_NAME)) == NULL)
+      if ((attr = _papplClientFindAttribute(client, "requesting-user-name", IPP_TAG_NAME)) == NULL)
       {
 	papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Need \"requesting-user-name\" with \"my-jobs\".");
 	return;
@@ -1499,7 +1446,7 @@ ipp_get_jobs(pappl_client_t *client)	// I - Client
 
   papplClientRespondIPP(client, IPP_STATUS_OK, NULL);
 
-  pthread_rwlock_rdlock(&(client->printer->rwlock));
+  pthread_rwlock_rdlock(&(client->printer->jobs_rwlock));
 
   count = cupsArrayGetCount(list);
   if (limit == 0 || limit > count)
@@ -1522,7 +1469,7 @@ ipp_get_jobs(pappl_client_t *client)	// I - Client
 
   cupsArrayDelete(ra);
 
-  pthread_rwlock_unlock(&(client->printer->rwlock));
+  pthread_rwlock_unlock(&(client->printer->jobs_rwlock));
 }
 
 
@@ -1551,11 +1498,13 @@ ipp_get_printer_attributes(
 
   papplClientRespondIPP(client, IPP_STATUS_OK, NULL);
 
+  pthread_rwlock_rdlock(&(printer->jobs_rwlock));
   pthread_rwlock_rdlock(&(printer->rwlock));
 
-  _papplPrinterCopyAttributes(printer, client, ra, ippGetString(ippFindAttribute(client->request, "document-format", IPP_TAG_MIMETYPE), 0, NULL));
+  _papplPrinterCopyAttributes(printer, client, ra, ippGetString(_papplClientFindAttribute(client, "document-format", IPP_TAG_MIMETYPE), 0, NULL));
 
   pthread_rwlock_unlock(&(printer->rwlock));
+  pthread_rwlock_unlock(&(printer->jobs_rwlock));
 
   cupsArrayDelete(ra);
 }
@@ -1577,7 +1526,7 @@ ipp_identify_printer(
 
   if (client->printer->driver_data.identify_cb)
   {
-    if ((attr = ippFindAttribute(client->request, "identify-actions", IPP_TAG_KEYWORD)) != NULL)
+    if ((attr = _papplClientFindAttribute(client, "identify-actions", IPP_TAG_KEYWORD)) != NULL)
     {
       actions = PAPPL_IDENTIFY_ACTIONS_NONE;
 
@@ -1587,7 +1536,7 @@ ipp_identify_printer(
     else
       actions = client->printer->driver_data.identify_default;
 
-    if ((attr = ippFindAttribute(client->request, "message", IPP_TAG_TEXT)) != NULL)
+    if ((attr = _papplClientFindAttribute(client, "message", IPP_TAG_TEXT)) != NULL)
       message = ippGetString(attr, 0, NULL);
     else
       message = NULL;
@@ -1765,7 +1714,7 @@ valid_job_attributes(
   pthread_rwlock_rdlock(&client->printer->rwlock);
 
   // Check the various job template attributes...
-  if ((attr = ippFindAttribute(client->request, "copies", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "copies", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_INTEGER || ippGetInteger(attr, 0) < 1 || ippGetInteger(attr, 0) > 999)
     {
@@ -1774,7 +1723,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "ipp-attribute-fidelity", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "ipp-attribute-fidelity", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_BOOLEAN)
     {
@@ -1783,7 +1732,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "job-hold-until", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "job-hold-until", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || (ippGetValueTag(attr) != IPP_TAG_NAME && ippGetValueTag(attr) != IPP_TAG_NAMELANG && ippGetValueTag(attr) != IPP_TAG_KEYWORD) || strcmp(ippGetString(attr, 0, NULL), "no-hold"))
     {
@@ -1792,7 +1741,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "job-impressions", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "job-impressions", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_INTEGER || ippGetInteger(attr, 0) < 0)
     {
@@ -1801,7 +1750,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "job-name", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "job-name", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || (ippGetValueTag(attr) != IPP_TAG_NAME && ippGetValueTag(attr) != IPP_TAG_NAMELANG))
     {
@@ -1812,9 +1761,9 @@ valid_job_attributes(
     ippSetGroupTag(client->request, &attr, IPP_TAG_JOB);
   }
   else
-    ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_NAME, "job-name", NULL, "Untitled");
+    _papplClientIndexAttribute(client, ippAddString(client->request, IPP_TAG_JOB, IPP_TAG_NAME, "job-name", NULL, "Untitled"));
 
-  if ((attr = ippFindAttribute(client->request, "job-priority", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "job-priority", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_INTEGER || ippGetInteger(attr, 0) < 1 || ippGetInteger(attr, 0) > 100)
     {
@@ -1823,7 +1772,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "job-sheets", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "job-sheets", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || (ippGetValueTag(attr) != IPP_TAG_NAME && ippGetValueTag(attr) != IPP_TAG_NAMELANG && ippGetValueTag(attr) != IPP_TAG_KEYWORD) || strcmp(ippGetString(attr, 0, NULL), "none"))
     {
@@ -1832,7 +1781,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "media", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "media", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || (ippGetValueTag(attr) != IPP_TAG_NAME && ippGetValueTag(attr) != IPP_TAG_NAMELANG && ippGetValueTag(attr) != IPP_TAG_KEYWORD))
     {
@@ -1851,7 +1800,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "media-col", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "media-col", IPP_TAG_ZERO)) != NULL)
   {
     ipp_t		*col,		// media-col collection
 			*size;		// media-size collection
@@ -1930,7 +1879,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "multiple-document-handling", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "multiple-document-handling", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_KEYWORD || (strcmp(ippGetString(attr, 0, NULL), "separate-documents-uncollated-copies") && strcmp(ippGetString(attr, 0, NULL), "separate-documents-collated-copies")))
     {
@@ -1939,7 +1888,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "orientation-requested", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "orientation-requested", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_ENUM || ippGetInteger(attr, 0) < IPP_ORIENT_PORTRAIT || ippGetInteger(attr, 0) > IPP_ORIENT_NONE)
     {
@@ -1948,7 +1897,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "page-ranges", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "page-ranges", IPP_TAG_ZERO)) != NULL)
   {
     int upper = 0, lower = ippGetRange(attr, 0, &upper);
 					// "page-ranges" value
@@ -1960,7 +1909,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "print-color-mode", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "print-color-mode", IPP_TAG_ZERO)) != NULL)
   {
     pappl_color_mode_t value = _papplColorModeValue(ippGetString(attr, 0, NULL));
 					// "print-color-mode" value
@@ -1972,7 +1921,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "print-content-optimize", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "print-content-optimize", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_KEYWORD || !_papplContentValue(ippGetString(attr, 0, NULL)))
     {
@@ -1981,7 +1930,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "print-darkness", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "print-darkness", IPP_TAG_ZERO)) != NULL)
   {
     int value = ippGetInteger(attr, 0);	// "print-darkness" value
 
@@ -1992,7 +1941,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "print-quality", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "print-quality", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_ENUM || ippGetInteger(attr, 0) < IPP_QUALITY_DRAFT || ippGetInteger(attr, 0) > IPP_QUALITY_HIGH)
     {
@@ -2001,7 +1950,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "print-scaling", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "print-scaling", IPP_TAG_ZERO)) != NULL)
   {
     if (ippGetCount(attr) != 1 || ippGetValueTag(attr) != IPP_TAG_KEYWORD || !_papplScalingValue(ippGetString(attr, 0, NULL)))
     {
@@ -2010,7 +1959,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "print-speed", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "print-speed", IPP_TAG_ZERO)) != NULL)
   {
     int value = ippGetInteger(attr, 0);	// "print-speed" value
 
@@ -2021,7 +1970,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "printer-resolution", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "printer-resolution", IPP_TAG_ZERO)) != NULL)
   {
     int		xdpi,			// Horizontal resolution
 		ydpi;			// Vertical resolution
@@ -2050,7 +1999,7 @@ valid_job_attributes(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "sides", IPP_TAG_ZERO)) != NULL)
+  if ((attr = _papplClientFindAttribute(client, "sides", IPP_TAG_ZERO)) != NULL)
   {
     pappl_sides_t value = _papplSidesValue(ippGetString(attr, 0, NULL));
 					// "sides" value
@@ -30,10 +30,28 @@
 #  include "device.h"
 
 
+//
+// Constants...
+//
+
+#  define _PAPPL_DEVICE_RETRY_MIN	1000	// Initial delay between device open attempts in milliseconds
+#  define _PAPPL_DEVICE_RETRY_MAX	60000	// Maximum delay between device open attempts in milliseconds
+#  define _PAPPL_THREAD_WARNING		30000	// Time to wait for raw/USB/compression threads before logging a warning in milliseconds
+#  define _PAPPL_WEB_STATUS_TTL		5	// Maximum age of cached web status HTML in seconds
+
+
 //
 // Types and structures...
 //
 
+typedef struct _pappl_media_size_s	// Cached media size
+{
+  pwg_media_t		pwg;			// PWG media information
+  char			name[64],		// PWG media name
+			legacy[64],		// Legacy media name
+			ppd[64];		// PPD media name
+} _pappl_media_size_t;
+
 struct _pappl_printer_s			// Printer data
 {
   pthread_rwlock_t	rwlock;			// Reader/writer lock
@@ -52,6 +70,9 @@ struct _pappl_printer_s			// Printer data
   ipp_pstate_t		state;			// "printer-state" value
   pappl_preason_t	state_reasons;		// "printer-state-reasons" values
   time_t		state_time;		// "printer-state-change-time" value
+  unsigned		state_changes,		// Number of "printer-state" changes
+			reasons_changes,	// Number of "printer-state-reasons" changes
+			supply_changes;		// Number of "printer-supply" changes
   bool			is_accepting,		// Are we accepting jobs?
 			is_stopped,		// Are we stopping this printer?
 			is_deleted;		// Has this printer been deleted?
@@ -59,10 +80,17 @@ struct _pappl_printer_s			// Printer data
 			*device_uri;		// Device URI
   pappl_device_t	*device;		// Current connection to device (if any)
   bool			device_in_use;		// Is the device in use?
+  pthread_mutex_t	device_mutex;		// Mutex for device availability
+  pthread_cond_t	device_cond;		// Device availability condition
+  unsigned		device_gen;		// Device availability generation
   char			*driver_name;		// Driver name
   pappl_pr_driver_data_t driver_data;		// Driver data
   ipp_t			*driver_attrs;		// Driver attributes
+  unsigned		driver_version;		// Driver attributes version
   int			num_ready;		// Number of ready media
+  _pappl_media_size_t	*media_sizes;		// Cached media sizes, sorted by name
+  int			num_media_sizes;	// Number of cached media sizes
+  ipp_t			*media_attrs;		// Cached "media-col-default/ready" attributes
   ipp_t			*attrs;			// Other (static) printer attributes
   time_t		start_time;		// Startup time
   time_t		config_time;		// "printer-config-change-time" value
@@ -76,12 +104,22 @@ struct _pappl_printer_s			// Printer data
   int			max_active_jobs,	// Maximum number of active jobs to accept
 			max_completed_jobs,	// Maximum number of completed jobs to retain in history
 			max_preserved_jobs;	// Maximum number of completed jobs to preserve in history
+  size_t		max_preserved_bytes;	// Maximum bytes of preserved document data, `0` for unlimited
+  pthread_rwlock_t	jobs_rwlock;		// Reader/writer lock for job arrays
   cups_array_t		*active_jobs,		// Array of active jobs
 			*all_jobs,		// Array of all jobs
 			*completed_jobs;	// Array of completed jobs
   int			next_job_id,		// Next "job-id" value
 			impcompleted;		// "printer-impressions-completed" value
   cups_array_t		*links;			// Web navigation links
+  cups_array_t		*icons;			// Loaded or scaled icon data, if any
+  unsigned		event_count;		// Number of events (state changes) so far
+  size_t		memused;		// Bytes recorded for memory accounting
+  pthread_mutex_t	web_mutex;		// Mutex for cached web status HTML
+  char			*web_status;		// Cached web status HTML
+  size_t		web_status_len;		// Length of cached web status HTML
+  char			web_status_key[65];	// SHA2-256 key for cached web status HTML
+  time_t		web_status_time;	// Time of cached web status HTML
 #  ifdef HAVE_MDNSRESPONDER
   _pappl_srv_t		dns_sd_ipp_ref,		// DNS-SD IPP service
 			dns_sd_ipps_ref,	// DNS-SD IPPS service
@@ -94,8 +132,12 @@ struct _pappl_printer_s			// Printer data
   _pappl_srv_t		dns_sd_ref;		// DNS-SD services
 #  endif // HAVE_MDNSRESPONDER
   unsigned char		dns_sd_loc[16];		// DNS-SD LOC record data
+  char			dns_sd_key[65];		// SHA2-256 key for registered DNS-SD services
   bool			dns_sd_collision;	// Was there a name collision?
   int			dns_sd_serial;		// DNS-SD serial number (for collisions)
+  pthread_mutex_t	threads_mutex;		// Mutex for raw/USB/compression thread state
+  pthread_cond_t	threads_cond;		// Raw/USB/compression thread state condition
+  int			num_compressing;	// Number of document compression threads
   bool			raw_active;		// Raw listener active?
   int			num_raw_listeners;	// Number of raw socket listeners
   struct pollfd		raw_listeners[2];	// Raw socket listeners
@@ -124,12 +166,19 @@ extern void		_papplPrinterCopyAttributes(pappl_printer_t *printer, pappl_client_
 extern void		_papplPrinterCopyState(pappl_printer_t *printer, ipp_tag_t group_tag, ipp_t *ipp, pappl_client_t *client, cups_array_t *ra) _PAPPL_PRIVATE;
 extern void		_papplPrinterCopyXRI(pappl_printer_t *printer, ipp_t *ipp, pappl_client_t *client) _PAPPL_PRIVATE;
 extern void		_papplPrinterDelete(pappl_printer_t *printer) _PAPPL_PRIVATE;
+extern pwg_media_t	*_papplPrinterFindMedia(pappl_printer_t *printer, const char *size_name) _PAPPL_PRIVATE;
+extern pwg_media_t	*_papplPrinterFindMediaForSize(pappl_printer_t *printer, int width, int length) _PAPPL_PRIVATE;
 extern void		_papplPrinterInitDriverData(pappl_pr_driver_data_t *d) _PAPPL_PRIVATE;
 extern bool		_papplPrinterIsAuthorized(pappl_client_t *client) _PAPPL_PRIVATE;
 extern void		_papplPrinterProcessIPP(pappl_client_t *client) _PAPPL_PRIVATE;
 extern bool		_papplPrinterRegisterDNSSDNoLock(pappl_printer_t *printer) _PAPPL_PRIVATE;
 extern bool		_papplPrinterSetAttributes(pappl_client_t *client, pappl_printer_t *printer) _PAPPL_PRIVATE;
+extern void		_papplPrinterSetThreadActive(pappl_printer_t *printer, bool *active, bool value) _PAPPL_PRIVATE;
 extern void		_papplPrinterUnregisterDNSSDNoLock(pappl_printer_t *printer) _PAPPL_PRIVATE;
+extern void		_papplPrinterUpdateMediaNoLock(pappl_printer_t *printer) _PAPPL_PRIVATE;
+extern bool		_papplPrinterWaitDevice(pappl_printer_t *printer, int msecs) _PAPPL_PRIVATE;
+extern void		_papplPrinterWaitThreads(pappl_printer_t *printer) _PAPPL_PRIVATE;
+extern void		_papplPrinterWakeDevice(pappl_printer_t *printer) _PAPPL_PRIVATE;
 
 extern void		_papplPrinterWebCancelAllJobs(pappl_client_t *client, pappl_printer_t *printer) _PAPPL_PRIVATE;
 extern void		_papplPrinterWebCancelJob(pappl_client_t *client, pappl_printer_t *printer) _PAPPL_PRIVATE;
@@ -163,7 +212,7 @@ extern pappl_label_mode_t _papplLabelModeValue(const char *s) _PAPPL_PRIVATE;
 extern const char	*_papplMarkerColorString(pappl_supply_color_t v) _PAPPL_PRIVATE;
 extern const char	*_papplMarkerTypeString(pappl_supply_type_t v) _PAPPL_PRIVATE;
 extern ipp_t		*_papplMediaColExport(pappl_pr_driver_data_t *driver_data, pappl_media_col_t *media, bool db) _PAPPL_PRIVATE;
-extern void		_papplMediaColImport(ipp_t *col, pappl_media_col_t *media) _PAPPL_PRIVATE;
+extern void		_papplMediaColImport(pappl_printer_t *printer, ipp_t *col, pappl_media_col_t *media) _PAPPL_PRIVATE;
 
 extern const char	*_papplMediaTrackingString(pappl_media_tracking_t v);
 extern pappl_media_tracking_t _papplMediaTrackingValue(const char *s);
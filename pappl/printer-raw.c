@@ -85,12 +85,12 @@ _papplPrinterRunRaw(
 
   papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Running socket print thread with %d listeners.", printer->num_raw_listeners);
 
-  printer->raw_active = true;
+  _papplPrinterSetThreadActive(printer, &printer->raw_active, true);
 
   while (!printer->is_deleted && printer->system->is_running)
   {
     // Don't accept connections if we can't accept a new job...
-    while ((int)cupsArrayGetCount(printer->active_jobs) >= printer->max_active_jobs && !printer->is_deleted && printer->system->is_running)
+    while (papplPrinterGetNumberOfActiveJobs(printer) >= printer->max_active_jobs && !printer->is_deleted && printer->system->is_running)
       usleep(100000);
 
     if (printer->is_deleted || !printer->system->is_running)
@@ -147,6 +147,8 @@ _papplPrinterRunRaw(
 	    goto abort_job;
 	  }
 
+          _papplJobUpdateMemory(job);
+
 	  papplLogJob(job, PAPPL_LOGLEVEL_DEBUG, "Created job file \"%s\", format \"%s\".", filename, job->format);
 
           activity     = time(NULL);
@@ -207,7 +209,7 @@ _papplPrinterRunRaw(
 	  job->state     = IPP_JSTATE_ABORTED;
 	  job->completed = time(NULL);
 
-	  pthread_rwlock_wrlock(&printer->rwlock);
+	  pthread_rwlock_wrlock(&printer->jobs_rwlock);
 
 	  cupsArrayRemove(printer->active_jobs, job);
 	  cupsArrayAdd(printer->completed_jobs, job);
@@ -215,7 +217,7 @@ _papplPrinterRunRaw(
 	  if (!printer->system->clean_time)
 	    printer->system->clean_time = time(NULL) + 60;
 
-	  pthread_rwlock_unlock(&printer->rwlock);
+	  pthread_rwlock_unlock(&printer->jobs_rwlock);
         }
       }
     }
@@ -223,7 +225,7 @@ _papplPrinterRunRaw(
       break;
   }
 
-  printer->raw_active = false;
+  _papplPrinterSetThreadActive(printer, &printer->raw_active, false);
 
   return (NULL);
 }
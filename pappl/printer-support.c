@@ -454,6 +454,7 @@ _papplMediaColExport(
 
 void
 _papplMediaColImport(
+    pappl_printer_t   *printer,		// I - Printer for cached sizes or `NULL`
     ipp_t             *col,		// I - IPP "media-col" value
     pappl_media_col_t *media)		// O - Media values
 {
@@ -474,7 +475,7 @@ _papplMediaColImport(
   if (size_name)
   {
     const char	*pwg_name = ippGetString(size_name, 0, NULL);
-    pwg_media_t	*pwg_media = pwgMediaForPWG(pwg_name);
+    pwg_media_t	*pwg_media = _papplPrinterFindMedia(printer, pwg_name);
 
     papplCopyString(media->size_name, pwg_name, sizeof(media->size_name));
     media->size_width  = pwg_media->width;
@@ -482,7 +483,7 @@ _papplMediaColImport(
   }
   else if (x_dimension && y_dimension)
   {
-    pwg_media_t	*pwg_media = pwgMediaForSize(ippGetInteger(x_dimension, 0), ippGetInteger(y_dimension, 0));
+    pwg_media_t	*pwg_media = _papplPrinterFindMediaForSize(printer, ippGetInteger(x_dimension, 0), ippGetInteger(y_dimension, 0));
 
     papplCopyString(media->size_name, pwg_media->pwg, sizeof(media->size_name));
     media->size_width  = pwg_media->width;
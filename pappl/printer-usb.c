@@ -115,7 +115,7 @@ _papplPrinterRunUSB(
   time_t	device_time = 0;	// Last time moving data...
 
 
-  printer->usb_active = enable_usb_printer(printer, ifaces);
+  _papplPrinterSetThreadActive(printer, &printer->usb_active, enable_usb_printer(printer, ifaces));
 
   if (!printer->usb_active)
   {
@@ -399,18 +399,11 @@ papplPrinterSetUSB(
     // Start USB gadget if needed...
     if (printer->system->is_running && printer->system->default_printer_id == printer->printer_id && (printer->system->options & PAPPL_SOPTIONS_USB_PRINTER))
     {
-      pthread_t	tid;			// Thread ID
-
-      if (pthread_create(&tid, NULL, (void *(*)(void *))_papplPrinterRunUSB, printer))
+      if (!_papplSystemCreateThread(printer->system, PAPPL_THREAD_DEVICE, NULL, (void *(*)(void *))_papplPrinterRunUSB, printer))
       {
 	// Unable to create USB thread...
 	papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to create USB gadget thread: %s", strerror(errno));
       }
-      else
-      {
-	// Detach the main thread from the raw thread to prevent hangs...
-	pthread_detach(tid);
-      }
     }
   }
 }
@@ -789,7 +782,7 @@ disable_usb_printer(
   for (i = 0; i < NUM_IPP_USB; i ++)
     delete_ipp_usb_iface(ifaces + i);
 
-  printer->usb_active = false;
+  _papplPrinterSetThreadActive(printer, &printer->usb_active, false);
 }
 
 
@@ -19,11 +19,14 @@
 // Local functions...
 //
 
+static void	expand_status(pappl_client_t *client, const char *html, size_t htmllen, const char *token, const char *baseurl);
 static void	job_cb(pappl_job_t *job, pappl_client_t *client);
 static void	job_pager(pappl_client_t *client, pappl_printer_t *printer, int job_index, int limit);
 static char	*localize_keyword(pappl_client_t *client, const char *attrname, const char *keyword, char *buffer, size_t bufsize);
 static char	*localize_media(pappl_client_t *client, pappl_media_col_t *media, bool include_source, char *buffer, size_t bufsize);
+static char	*make_status_template(const char *html, size_t htmllen, const char *token, const char *baseurl, size_t *templen);
 static void	media_chooser(pappl_client_t *client, pappl_pr_driver_data_t *driver_data, const char *title, const char *name, pappl_media_col_t *media);
+static void	printer_status(pappl_printer_t *printer, pappl_client_t *client);
 static char	*time_string(time_t tv, char *buffer, size_t bufsize);
 
 
@@ -951,7 +954,7 @@ _papplPrinterWebHome(
 
   if (papplPrinterGetNumberOfJobs(printer) > 0)
   {
-    if (cupsArrayGetCount(printer->active_jobs) > 0)
+    if (papplPrinterGetNumberOfActiveJobs(printer) > 0)
       papplClientHTMLPrintf(client, " <a class=\"btn\" href=\"%s://%s:%d%s/cancelall\">%s</a></h1>\n", _papplClientGetAuthWebScheme(client), client->host_field, client->host_port, printer->uriname, papplClientGetLocString(client, _PAPPL_LOC("Cancel All Jobs")));
     else
       papplClientHTMLPuts(client, "</h1>\n");
@@ -989,93 +992,93 @@ _papplPrinterWebHome(
 //
 // '_papplPrinterWebIteratorCallback()' - Show the printer status.
 //
+// The status shown on the system home page is cached for a few seconds and
+// reused until the printer configuration, state, state reasons, supplies,
+// active jobs, or the client's language changes.  The cached HTML is a
+// template with placeholders for the client's CSRF token and base URL, which
+// are filled in for each client.
+//
 
 void
 _papplPrinterWebIteratorCallback(
     pappl_printer_t *printer,		// I - Printer
     pappl_client_t  *client)		// I - Client
 {
-  int			i;		// Looping var
-  pappl_preason_t	reason,		// Current reason
-			printer_reasons;// Printer state reasons
-  ipp_pstate_t		printer_state;	// Printer state
-  int			printer_jobs;	// Number of queued jobs
-  char			state_str[8],	// State string
-			jobs_str[256],	// Number of jobs string
-			uri[256],	// Form URI
-			text[1024];	// Localized text
+  char		token[256],		// CSRF token
+		baseurl[1024],		// Base URL for the client
+		keydata[2048],		// Cache key data
+		key[65];		// Cache key
+  unsigned char	keysum[32];		// SHA2-256 sum of key data
+  const char	*html;			// Rendered HTML
+  size_t	htmllen;		// Length of rendered HTML
+  char		*temp;			// New cache buffer
+  size_t	templen;		// Length of new cache buffer
+  time_t	curtime;		// Current time
+  int		active;			// Number of active jobs
+
+
+  if (strcmp(client->uri, "/"))
+  {
+    // Only the system home page is cached...
+    printer_status(printer, client);
+    return;
+  }
 
+  papplClientGetCSRFToken(client, token, sizeof(token));
+  snprintf(baseurl, sizeof(baseurl), "%s://%s:%d", _papplClientGetAuthWebScheme(client), client->host_field, client->host_port);
 
-  printer_jobs    = papplPrinterGetNumberOfActiveJobs(printer);
-  printer_state   = papplPrinterGetState(printer);
-  printer_reasons = papplPrinterGetReasons(printer);
+  // Build the cache key from everything else that affects the rendered HTML...
+  active = papplPrinterGetNumberOfActiveJobs(printer);
 
-  snprintf(uri, sizeof(uri), "%s/", printer->uriname);
+  pthread_rwlock_rdlock(&printer->rwlock);
+  snprintf(keydata, sizeof(keydata), "%ld|%u|%u|%u|%d|%d|%s", (long)printer->config_time, printer->state_changes, printer->reasons_changes, printer->supply_changes, active, printer->printer_id == printer->system->default_printer_id, client->language);
+  pthread_rwlock_unlock(&printer->rwlock);
 
-  if (!strcmp(client->uri, "/") && (client->system->options & PAPPL_SOPTIONS_MULTI_QUEUE))
-    papplClientHTMLPrintf(client,
-			  "          <h2 class=\"title\"><a href=\"%s/\">%s</a> <a class=\"btn\" href=\"%s://%s:%d%s/delete\">%s</a></h2>\n", printer->uriname, printer->name, _papplClientGetAuthWebScheme(client), client->host_field, client->host_port, printer->uriname, papplClientGetLocString(client, _PAPPL_LOC("Delete")));
-  else
-    papplClientHTMLPrintf(client, "          <h1 class=\"title\">%s</h1>\n", papplClientGetLocString(client, _PAPPL_LOC("Status")));
+  cupsHashData("sha2-256", keydata, strlen(keydata), keysum, sizeof(keysum));
+  cupsHashString(keysum, sizeof(keysum), key, sizeof(key));
 
-  snprintf(state_str, sizeof(state_str), "%d", (int)printer_state);
-  papplLocFormatString(papplClientGetLoc(client), jobs_str, sizeof(jobs_str), printer_jobs == 1 ? _PAPPL_LOC("%d job") : _PAPPL_LOC("%d jobs"), printer_jobs);
+  curtime = time(NULL);
 
-  papplClientHTMLPrintf(client,
-			"          <p><img class=\"%s\" src=\"%s/icon-md.png\">%s, %s", ippEnumString("printer-state", (int)printer_state), printer->uriname, localize_keyword(client, "printer-state", state_str, text, sizeof(text)), jobs_str);
-  if ((printer->system->options & PAPPL_SOPTIONS_MULTI_QUEUE) && printer->printer_id == printer->system->default_printer_id)
-    papplClientHTMLPrintf(client, ", %s", papplClientGetLocString(client, _PAPPL_LOC("default printer")));
+  pthread_mutex_lock(&printer->web_mutex);
 
-  for (i = 0, reason = PAPPL_PREASON_OTHER; reason <= PAPPL_PREASON_TONER_LOW; i ++, reason *= 2)
+  if (printer->web_status && (curtime - printer->web_status_time) < _PAPPL_WEB_STATUS_TTL && !strcmp(key, printer->web_status_key))
   {
-    if (printer_reasons & reason)
-      papplClientHTMLPrintf(client, ", %s", localize_keyword(client, "printer-state-reasons", _papplPrinterReasonString(reason), text, sizeof(text)));
-  }
+    // Expand the cached HTML so we don't hold the lock while writing...
+    _papplClientHTMLStartCapture(client);
+    expand_status(client, printer->web_status, printer->web_status_len, token, baseurl);
 
-  if (strcmp(printer->name, printer->driver_data.make_and_model))
-    papplClientHTMLPrintf(client, ".<br>%s</p>\n", printer->driver_data.make_and_model);
-  else
-    papplClientHTMLPuts(client, ".</p>\n");
-
-  papplClientHTMLPuts(client, "          <div class=\"btn\">");
-  _papplClientHTMLPutLinks(client, printer->links, PAPPL_LOPTIONS_STATUS);
+    pthread_mutex_unlock(&printer->web_mutex);
 
-  if (printer->driver_data.identify_supported)
-  {
-    papplClientHTMLStartForm(client, uri, false);
-    papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"identify-printer\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Identify Printer")));
+    html = _papplClientHTMLEndCapture(client, &htmllen);
+    _papplClientHTMLWrite(client, html, htmllen);
+    return;
   }
 
-  if (printer->driver_data.testpage_cb)
-  {
-    papplClientHTMLStartForm(client, uri, false);
-    papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"print-test-page\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Print Test Page")));
-  }
+  pthread_mutex_unlock(&printer->web_mutex);
 
-  if (printer->system->options & PAPPL_SOPTIONS_MULTI_QUEUE)
+  // Render and cache the status...
+  _papplClientHTMLStartCapture(client);
+  printer_status(printer, client);
+  html = _papplClientHTMLEndCapture(client, &htmllen);
+
+  if (htmllen > 0)
   {
-    if (printer->state == IPP_PSTATE_STOPPED)
+    if ((temp = make_status_template(html, htmllen, token, baseurl, &templen)) != NULL)
     {
-      papplClientHTMLStartForm(client, uri, false);
-      papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"resume-printer\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Resume Printing")));
-    }
-    else
-    {
-      papplClientHTMLStartForm(client, uri, false);
-      papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"pause-printer\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Pause Printing")));
-    }
+      pthread_mutex_lock(&printer->web_mutex);
 
-    if (printer->printer_id != printer->system->default_printer_id)
-    {
-      papplClientHTMLStartForm(client, uri, false);
-      papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"set-as-default\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Set as Default")));
-    }
-  }
+      free(printer->web_status);
 
-  if (strcmp(client->uri, "/") && (client->system->options & PAPPL_SOPTIONS_MULTI_QUEUE))
-    papplClientHTMLPrintf(client, " <a class=\"btn\" href=\"%s://%s:%d%s/delete\">%s</a>", _papplClientGetAuthWebScheme(client), client->host_field, client->host_port, printer->uriname, papplClientGetLocString(client, _PAPPL_LOC("Delete Printer")));
+      printer->web_status      = temp;
+      printer->web_status_len  = templen;
+      printer->web_status_time = curtime;
+      papplCopyString(printer->web_status_key, key, sizeof(printer->web_status_key));
 
-  papplClientHTMLPuts(client, "<br clear=\"all\"></div>\n");
+      pthread_mutex_unlock(&printer->web_mutex);
+    }
+
+    _papplClientHTMLWrite(client, html, htmllen);
+  }
 }
 
 
@@ -1111,7 +1114,7 @@ _papplPrinterWebJobs(
     cupsFreeOptions(num_form, form);
   }
 
-  if (cupsArrayGetCount(printer->active_jobs) > 0)
+  if (papplPrinterGetNumberOfActiveJobs(printer) > 0)
   {
     char	url[1024];		// URL for Cancel All Jobs
 
@@ -1391,32 +1394,15 @@ _papplPrinterWebReprintJob(
         // Copy the job...
         if ((new_job = _papplJobCreate(printer, 0, username, job->format, job->name, job->attrs)) != NULL)
         {
-          // Copy the job file...
-          int		oldfd,		// Old job file
-			newfd;		// New job file
-	  char		buffer[8192];	// Copy buffer
-	  ssize_t	bytes;		// Bytes read...
-
-          if ((oldfd = open(job->filename, O_RDONLY | O_BINARY)) >= 0)
+          // Copy the job file and submit the job for processing...
+          if (job->filename && _papplJobCopyFile(new_job, job->filename, path, sizeof(path)))
           {
-            if ((newfd = papplJobOpenFile(new_job, path, sizeof(path), printer->system->directory, NULL, "w")) >= 0)
-            {
-              while ((bytes = read(oldfd, buffer, sizeof(buffer))) > 0)
-                write(newfd, buffer, (size_t)bytes);
+	    _papplJobSubmitFile(new_job, path);
 
-              close(oldfd);
-              close(newfd);
-
-	      // Submit the job for processing...
-	      _papplJobSubmitFile(new_job, path);
-
-	      snprintf(path, sizeof(path), "%s/jobs", printer->uriname);
-	      papplClientRespondRedirect(client, HTTP_STATUS_FOUND, path);
-	      cupsFreeOptions(num_form, form);
-	      return;
-	    }
-
-	    close(oldfd);
+	    snprintf(path, sizeof(path), "%s/jobs", printer->uriname);
+	    papplClientRespondRedirect(client, HTTP_STATUS_FOUND, path);
+	    cupsFreeOptions(num_form, form);
+	    return;
           }
 	}
 
@@ -1513,6 +1499,43 @@ _papplPrinterWebSupplies(
 }
 
 
+//
+// 'expand_status()' - Write cached printer status HTML for a client.
+//
+// The "\001T" and "\001U" placeholders in the cached HTML are replaced by the
+// client's CSRF token and base URL, respectively.
+//
+
+static void
+expand_status(
+    pappl_client_t *client,		// I - Client
+    const char     *html,		// I - Cached HTML
+    size_t         htmllen,		// I - Length of cached HTML
+    const char     *token,		// I - CSRF token
+    const char     *baseurl)		// I - Base URL
+{
+  const char	*htmlend = html + htmllen,
+					// End of cached HTML
+		*marker;		// Current placeholder
+
+
+  while (html < htmlend && (marker = memchr(html, '\001', (size_t)(htmlend - html))) != NULL && marker < (htmlend - 1))
+  {
+    _papplClientHTMLWrite(client, html, (size_t)(marker - html));
+
+    if (marker[1] == 'T')
+      papplClientHTMLPuts(client, token);
+    else if (marker[1] == 'U')
+      papplClientHTMLPuts(client, baseurl);
+
+    html = marker + 2;
+  }
+
+  if (html < htmlend)
+    _papplClientHTMLWrite(client, html, (size_t)(htmlend - html));
+}
+
+
 //
 // 'job_cb()' - Job iterator callback.
 //
@@ -1714,6 +1737,62 @@ localize_media(
 }
 
 
+//
+// 'make_status_template()' - Make a cacheable template from printer status HTML.
+//
+// Every occurrence of the client's CSRF token and base URL is replaced by a
+// "\001T" or "\001U" placeholder so the HTML can be reused for other clients.
+// The returned string must be freed with `free`.
+//
+
+static char *				// O - Template or `NULL` on error
+make_status_template(
+    const char *html,			// I - Rendered HTML
+    size_t     htmllen,			// I - Length of rendered HTML
+    const char *token,			// I - CSRF token
+    const char *baseurl,		// I - Base URL
+    size_t     *templen)		// O - Length of template
+{
+  char		*temp,			// Template
+		*tempptr;		// Pointer into template
+  const char	*htmlend = html + htmllen;
+					// End of rendered HTML
+  size_t	tokenlen = strlen(token),
+					// Length of CSRF token
+		baselen = strlen(baseurl);
+					// Length of base URL
+
+
+  // Placeholders are never longer than what they replace...
+  if ((temp = malloc(htmllen)) == NULL)
+    return (NULL);
+
+  for (tempptr = temp; html < htmlend;)
+  {
+    if (tokenlen > 0 && (size_t)(htmlend - html) >= tokenlen && !memcmp(html, token, tokenlen))
+    {
+      *tempptr++ = '\001';
+      *tempptr++ = 'T';
+      html += tokenlen;
+    }
+    else if (baselen > 2 && (size_t)(htmlend - html) >= baselen && !memcmp(html, baseurl, baselen))
+    {
+      *tempptr++ = '\001';
+      *tempptr++ = 'U';
+      html += baselen;
+    }
+    else
+    {
+      *tempptr++ = *html++;
+    }
+  }
+
+  *templen = (size_t)(tempptr - temp);
+
+  return (temp);
+}
+
+
 //
 // 'media_chooser()' - Show the media chooser.
 //
@@ -1874,6 +1953,99 @@ media_chooser(
 }
 
 
+//
+// 'printer_status()' - Show the printer status.
+//
+
+static void
+printer_status(
+    pappl_printer_t *printer,		// I - Printer
+    pappl_client_t  *client)		// I - Client
+{
+  int			i;		// Looping var
+  pappl_preason_t	reason,		// Current reason
+			printer_reasons;// Printer state reasons
+  ipp_pstate_t		printer_state;	// Printer state
+  int			printer_jobs;	// Number of queued jobs
+  char			state_str[8],	// State string
+			jobs_str[256],	// Number of jobs string
+			uri[256],	// Form URI
+			text[1024];	// Localized text
+
+
+  printer_jobs    = papplPrinterGetNumberOfActiveJobs(printer);
+  printer_state   = papplPrinterGetState(printer);
+  printer_reasons = papplPrinterGetReasons(printer);
+
+  snprintf(uri, sizeof(uri), "%s/", printer->uriname);
+
+  if (!strcmp(client->uri, "/") && (client->system->options & PAPPL_SOPTIONS_MULTI_QUEUE))
+    papplClientHTMLPrintf(client,
+			  "          <h2 class=\"title\"><a href=\"%s/\">%s</a> <a class=\"btn\" href=\"%s://%s:%d%s/delete\">%s</a></h2>\n", printer->uriname, printer->name, _papplClientGetAuthWebScheme(client), client->host_field, client->host_port, printer->uriname, papplClientGetLocString(client, _PAPPL_LOC("Delete")));
+  else
+    papplClientHTMLPrintf(client, "          <h1 class=\"title\">%s</h1>\n", papplClientGetLocString(client, _PAPPL_LOC("Status")));
+
+  snprintf(state_str, sizeof(state_str), "%d", (int)printer_state);
+  papplLocFormatString(papplClientGetLoc(client), jobs_str, sizeof(jobs_str), printer_jobs == 1 ? _PAPPL_LOC("%d job") : _PAPPL_LOC("%d jobs"), printer_jobs);
+
+  papplClientHTMLPrintf(client,
+			"          <p><img class=\"%s\" src=\"%s/icon-md.png\">%s, %s", ippEnumString("printer-state", (int)printer_state), printer->uriname, localize_keyword(client, "printer-state", state_str, text, sizeof(text)), jobs_str);
+  if ((printer->system->options & PAPPL_SOPTIONS_MULTI_QUEUE) && printer->printer_id == printer->system->default_printer_id)
+    papplClientHTMLPrintf(client, ", %s", papplClientGetLocString(client, _PAPPL_LOC("default printer")));
+
+  for (i = 0, reason = PAPPL_PREASON_OTHER; reason <= PAPPL_PREASON_TONER_LOW; i ++, reason *= 2)
+  {
+    if (printer_reasons & reason)
+      papplClientHTMLPrintf(client, ", %s", localize_keyword(client, "printer-state-reasons", _papplPrinterReasonString(reason), text, sizeof(text)));
+  }
+
+  if (strcmp(printer->name, printer->driver_data.make_and_model))
+    papplClientHTMLPrintf(client, ".<br>%s</p>\n", printer->driver_data.make_and_model);
+  else
+    papplClientHTMLPuts(client, ".</p>\n");
+
+  papplClientHTMLPuts(client, "          <div class=\"btn\">");
+  _papplClientHTMLPutLinks(client, printer->links, PAPPL_LOPTIONS_STATUS);
+
+  if (printer->driver_data.identify_supported)
+  {
+    papplClientHTMLStartForm(client, uri, false);
+    papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"identify-printer\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Identify Printer")));
+  }
+
+  if (printer->driver_data.testpage_cb)
+  {
+    papplClientHTMLStartForm(client, uri, false);
+    papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"print-test-page\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Print Test Page")));
+  }
+
+  if (printer->system->options & PAPPL_SOPTIONS_MULTI_QUEUE)
+  {
+    if (printer->state == IPP_PSTATE_STOPPED)
+    {
+      papplClientHTMLStartForm(client, uri, false);
+      papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"resume-printer\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Resume Printing")));
+    }
+    else
+    {
+      papplClientHTMLStartForm(client, uri, false);
+      papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"pause-printer\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Pause Printing")));
+    }
+
+    if (printer->printer_id != printer->system->default_printer_id)
+    {
+      papplClientHTMLStartForm(client, uri, false);
+      papplClientHTMLPrintf(client, "<input type=\"hidden\" name=\"action\" value=\"set-as-default\"><input type=\"submit\" value=\"%s\"></form>", papplClientGetLocString(client, _PAPPL_LOC("Set as Default")));
+    }
+  }
+
+  if (strcmp(client->uri, "/") && (client->system->options & PAPPL_SOPTIONS_MULTI_QUEUE))
+    papplClientHTMLPrintf(client, " <a class=\"btn\" href=\"%s://%s:%d%s/delete\">%s</a>", _papplClientGetAuthWebScheme(client), client->host_field, client->host_port, printer->uriname, papplClientGetLocString(client, _PAPPL_LOC("Delete Printer")));
+
+  papplClientHTMLPuts(client, "<br clear=\"all\"></div>\n");
+}
+
+
 //
 // 'time_string()' - Return the local time in hours, minutes, and seconds.
 //
@@ -42,7 +42,7 @@ papplPrinterCancelAllJobs(
   // Loop through all jobs and cancel them.
   //
   // Since we have a writer lock, it is safe to use cupsArrayGetFirst/Last...
-  pthread_rwlock_wrlock(&printer->rwlock);
+  pthread_rwlock_wrlock(&printer->jobs_rwlock);
 
   for (job = (pappl_job_t *)cupsArrayGetFirst(printer->active_jobs); job; job = (pappl_job_t *)cupsArrayGetNext(printer->active_jobs))
   {
@@ -63,7 +63,9 @@ papplPrinterCancelAllJobs(
     }
   }
 
-  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
+
+  _papplPrinterWakeDevice(printer);
 
   if (!printer->system->clean_time)
     printer->system->clean_time = time(NULL) + 60;
@@ -331,6 +333,12 @@ papplPrinterCreate(
 
   // Initialize printer structure and attributes...
   pthread_rwlock_init(&printer->rwlock, NULL);
+  pthread_rwlock_init(&printer->jobs_rwlock, NULL);
+  pthread_mutex_init(&printer->device_mutex, NULL);
+  pthread_cond_init(&printer->device_cond, NULL);
+  pthread_mutex_init(&printer->threads_mutex, NULL);
+  pthread_cond_init(&printer->threads_cond, NULL);
+  pthread_mutex_init(&printer->web_mutex, NULL);
 
   printer->system             = system;
   printer->name               = strdup(printer_name);
@@ -645,20 +653,18 @@ papplPrinterCreate(
   {
     if (_papplPrinterAddRawListeners(printer) && system->is_running)
     {
-      pthread_t	tid;			// Thread ID
-
-      if (pthread_create(&tid, NULL, (void *(*)(void *))_papplPrinterRunRaw, printer))
+      if (!_papplSystemCreateThread(system, PAPPL_THREAD_DEVICE, NULL, (void *(*)(void *))_papplPrinterRunRaw, printer))
       {
 	// Unable to create client thread...
 	papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to create raw listener thread: %s", strerror(errno));
       }
       else
       {
-	// Detach the main thread from the raw thread to prevent hangs...
-	pthread_detach(tid);
-
+        // Wait for raw thread to start...
+        pthread_mutex_lock(&printer->threads_mutex);
 	while (!printer->raw_active)
-	  usleep(1000);			// Wait for raw thread to start
+	  pthread_cond_wait(&printer->threads_cond, &printer->threads_mutex);
+        pthread_mutex_unlock(&printer->threads_mutex);
       }
     }
   }
@@ -733,11 +739,17 @@ _papplPrinterDelete(
   // Let USB/raw printing threads know to exit
   printer->is_deleted = true;
 
-  while (printer->raw_active || printer->usb_active)
-  {
-    // Wait for threads to finish
-    usleep(100000);
-  }
+  _papplPrinterWakeDevice(printer);
+
+#if !_WIN32
+  // Shutting down the listener sockets wakes up the raw thread's poll() on
+  // Linux; other platforms will see the deletion at the next poll() timeout...
+  for (i = 0; i < printer->num_raw_listeners; i ++)
+    shutdown(printer->raw_listeners[i].fd, SHUT_RDWR);
+#endif // !_WIN32
+
+  // Wait for threads to finish
+  _papplPrinterWaitThreads(printer);
 
   // Close raw listener sockets...
   for (i = 0; i < printer->num_raw_listeners; i ++)
@@ -792,9 +804,22 @@ _papplPrinterDelete(
 
   ippDelete(printer->driver_attrs);
   ippDelete(printer->attrs);
+  ippDelete(printer->media_attrs);
+
+  _papplSystemUpdateMemory(printer->system, PAPPL_MEMORY_PRINTER_ATTRS, &printer->memused, 0);
+  free(printer->media_sizes);
+  free(printer->web_status);
+  cupsArrayDelete(printer->icons);
 
   cupsArrayDelete(printer->links);
 
+  pthread_cond_destroy(&printer->device_cond);
+  pthread_mutex_destroy(&printer->device_mutex);
+  pthread_cond_destroy(&printer->threads_cond);
+  pthread_mutex_destroy(&printer->threads_mutex);
+  pthread_mutex_destroy(&printer->web_mutex);
+  pthread_rwlock_destroy(&printer->jobs_rwlock);
+
   free(printer);
 }
 
@@ -920,6 +945,139 @@ papplPrinterOpenFile(
 }
 
 
+//
+// '_papplPrinterSetThreadActive()' - Set the active state of a raw/USB thread.
+//
+// This function updates the "raw_active" or "usb_active" member and signals
+// any thread waiting in @link _papplPrinterWaitThreads@.
+//
+
+void
+_papplPrinterSetThreadActive(
+    pappl_printer_t *printer,		// I - Printer
+    bool            *active,		// I - Pointer to "raw_active" or "usb_active"
+    bool            value)		// I - New value
+{
+  pthread_mutex_lock(&printer->threads_mutex);
+  *active = value;
+  pthread_cond_broadcast(&printer->threads_cond);
+  pthread_mutex_unlock(&printer->threads_mutex);
+}
+
+
+//
+// '_papplPrinterWaitDevice()' - Wait for the device availability to change.
+//
+// This function waits up to "msecs" milliseconds for a call to
+// @link _papplPrinterWakeDevice@.  Only wakeups that happen after the wait
+// starts are reported, so earlier wakeups with no waiter don't cut the next
+// wait short.  The printer's reader/writer lock must not be held by the caller.
+//
+
+bool					// O - `true` if woken up, `false` on timeout
+_papplPrinterWaitDevice(
+    pappl_printer_t *printer,		// I - Printer
+    int             msecs)		// I - Maximum time to wait in milliseconds
+{
+  bool			changed;	// Did the device availability change?
+  unsigned		gen;		// Device availability generation at start
+  struct timeval	curtime;	// Current time
+  struct timespec	timeout;	// Timeout
+
+
+  gettimeofday(&curtime, NULL);
+  timeout.tv_sec  = curtime.tv_sec + msecs / 1000;
+  timeout.tv_nsec = curtime.tv_usec * 1000 + (msecs % 1000) * 1000000;
+
+  if (timeout.tv_nsec >= 1000000000)
+  {
+    timeout.tv_sec ++;
+    timeout.tv_nsec -= 1000000000;
+  }
+
+  pthread_mutex_lock(&printer->device_mutex);
+
+  gen = printer->device_gen;
+
+  while (printer->device_gen == gen)
+  {
+    if (pthread_cond_timedwait(&printer->device_cond, &printer->device_mutex, &timeout))
+      break;
+  }
+
+  changed = printer->device_gen != gen;
+
+  pthread_mutex_unlock(&printer->device_mutex);
+
+  return (changed);
+}
+
+
+//
+// '_papplPrinterWaitThreads()' - Wait for the raw, USB, and document
+//                                compression threads to finish.
+//
+// The threads reference the printer, so this function waits for as long as
+// it takes and only logs a warning if they are slow to finish.
+//
+
+void
+_papplPrinterWaitThreads(
+    pappl_printer_t *printer)		// I - Printer
+{
+  bool			warned = false;	// Logged a warning?
+  struct timeval	curtime;	// Current time
+  struct timespec	timeout;	// Timeout
+
+
+  gettimeofday(&curtime, NULL);
+  timeout.tv_sec  = curtime.tv_sec + _PAPPL_THREAD_WARNING / 1000;
+  timeout.tv_nsec = curtime.tv_usec * 1000 + (_PAPPL_THREAD_WARNING % 1000) * 1000000;
+
+  if (timeout.tv_nsec >= 1000000000)
+  {
+    timeout.tv_sec ++;
+    timeout.tv_nsec -= 1000000000;
+  }
+
+  pthread_mutex_lock(&printer->threads_mutex);
+
+  while (printer->raw_active || printer->usb_active || printer->num_compressing > 0)
+  {
+    if (warned)
+    {
+      pthread_cond_wait(&printer->threads_cond, &printer->threads_mutex);
+    }
+    else if (pthread_cond_timedwait(&printer->threads_cond, &printer->threads_mutex, &timeout))
+    {
+      papplLogPrinter(printer, PAPPL_LOGLEVEL_WARN, "Still waiting for socket/USB/compression threads to finish.");
+      warned = true;
+    }
+  }
+
+  pthread_mutex_unlock(&printer->threads_mutex);
+}
+
+
+//
+// '_papplPrinterWakeDevice()' - Wake any threads waiting for the device.
+//
+// This function is called whenever the device might have become available,
+// for example after a hotplug event, or when a waiting job should give up
+// (canceled job, deleted printer, or system shutdown.)
+//
+
+void
+_papplPrinterWakeDevice(
+    pappl_printer_t *printer)		// I - Printer
+{
+  pthread_mutex_lock(&printer->device_mutex);
+  printer->device_gen ++;
+  pthread_cond_broadcast(&printer->device_cond);
+  pthread_mutex_unlock(&printer->device_mutex);
+}
+
+
 //
 // 'compare_active_jobs()' - Compare two active jobs.
 //
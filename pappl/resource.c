@@ -22,8 +22,8 @@
 
 static void		add_resource(pappl_system_t *system, _pappl_resource_t *r);
 static int		compare_resources(_pappl_resource_t *a, _pappl_resource_t *b);
-static _pappl_resource_t *copy_resource(_pappl_resource_t *r);
-static void		free_resource(_pappl_resource_t *r);
+static _pappl_resource_t *copy_resource(_pappl_resource_t *r, pappl_system_t *system);
+static void		free_resource(_pappl_resource_t *r, pappl_system_t *system);
 
 
 //
@@ -451,7 +451,7 @@ add_resource(pappl_system_t    *system,	// I - System object
     papplLog(system, PAPPL_LOGLEVEL_DEBUG, "Adding resource for '%s'.", r->path);
 
     if (!system->resources)
-      system->resources = cupsArrayNew((cups_array_cb_t)compare_resources, NULL, NULL, 0, (cups_acopy_cb_t)copy_resource, (cups_afree_cb_t)free_resource);
+      system->resources = cupsArrayNew((cups_array_cb_t)compare_resources, system, NULL, 0, (cups_acopy_cb_t)copy_resource, (cups_afree_cb_t)free_resource);
 
     cupsArrayAdd(system->resources, r);
   }
@@ -477,7 +477,9 @@ compare_resources(_pappl_resource_t *a,	// I - First resource
 //
 
 static _pappl_resource_t *		// O - New resource
-copy_resource(_pappl_resource_t *r)	// I - Resource to copy
+copy_resource(
+    _pappl_resource_t *r,		// I - Resource to copy
+    pappl_system_t    *system)		// I - System
 {
   _pappl_resource_t	*newr;		// New resource
 
@@ -492,6 +494,17 @@ copy_resource(_pappl_resource_t *r)	// I - Resource to copy
     newr->cb            = r->cb;
     newr->cbdata        = r->cbdata;
 
+    if (r->data && r->length > 0)
+    {
+      // Static data gets a strong entity tag based on its contents...
+      unsigned char	sum[32];	// SHA2-256 sum of data
+      char		sumstr[65];	// Hex version of sum
+
+      cupsHashData("sha2-256", r->data, r->length, sum, sizeof(sum));
+      cupsHashString(sum, sizeof(sum), sumstr, sizeof(sumstr));
+      snprintf(newr->etag, sizeof(newr->etag), "\"%.32s\"", sumstr);
+    }
+
     if (r->filename)
       newr->filename = strdup(r->filename);
     if (r->language)
@@ -499,9 +512,11 @@ copy_resource(_pappl_resource_t *r)	// I - Resource to copy
 
     if (!newr->path || !newr->format || (r->filename && !newr->filename) || (r->language && !newr->language))
     {
-      free_resource(newr);
+      free_resource(newr, system);
       return (NULL);
     }
+
+    _papplSystemUpdateMemory(system, PAPPL_MEMORY_RESOURCES, &newr->memused, sizeof(_pappl_resource_t) + strlen(newr->path) + strlen(newr->format) + (newr->filename ? strlen(newr->filename) : 0) + (newr->language ? strlen(newr->language) : 0) + 4);
   }
 
   return (newr);
@@ -513,8 +528,12 @@ copy_resource(_pappl_resource_t *r)	// I - Resource to copy
 //
 
 static void
-free_resource(_pappl_resource_t *r)	// I - Resource
+free_resource(
+    _pappl_resource_t *r,		// I - Resource
+    pappl_system_t    *system)		// I - System
 {
+  _papplSystemUpdateMemory(system, PAPPL_MEMORY_RESOURCES, &r->memused, 0);
+
   free(r->path);
   free(r->format);
   free(r->filename);
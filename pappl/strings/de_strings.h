@@ -1,4 +1,5 @@
-static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\" = \"  -a               Alle Jobs abbrechen (cancel.)\";\n"
+static const char *de_strings = "\"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\" = \"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\";\n"
+"\"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\" = \"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\";\n"
 "\"  -c COPIES\" = \"  -c COPIES\";\n"
 "\"  -d PRINTER       Specify printer.\" = \"  -d PRINTER       Drucker angeben.\";\n"
 "\"  -j JOB-ID        Specify job ID (cancel).\" = \"  -j JOB-ID        Stellenausschreibung (cancel.)\";\n"
@@ -33,6 +34,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"  submit           Submit a file for printing.\" = \"  submit           Senden Sie eine Datei zum Drucken.\";\n"
 "\"%d inches/sec\" = \"%d inches/sec\";\n"
 "\"%d job\" = \"%d Job\";\n"
+"\"%d jobs\" = \"%d jobs\";\n"
 /* Media size in millimeters */
 "\"%d x %dmm\" = \"%d x %d mm\";\n"
 "\"%ddpi\" = \"%d dpi\";\n"
@@ -45,6 +47,8 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"%s (%s%s) from %s\" = \"%s (%s%s) aus %s\";\n"
 /* Source/Tray Media */
 "\"%s Media\" = \"%s Medien\";\n"
+/* PRINTER: STATE since DATE REASONS */
+"\"%s: %s since %s%s.\" = \"%s: %s since %s%s.\";\n"
 "\"%s: Bad 'server-port' value.\" = \"%s: Schlechter Server-Port-Wert.\";\n"
 "\"%s: Bad job ID.\" = \"- Schlechte Job-ID.\";\n"
 "\"%s: Bad printer URI '%s'.\" = \"%s: Schlechter Drucker URI '%s'.\";\n"
@@ -130,6 +134,8 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Belize\" = \"Belize\";\n"
 "\"Benin\" = \"Benin\";\n"
 "\"Bermuda\" = \"In den Warenkorb\";\n"
+"\"Best (384-bit ECC)\" = \"Best (384-bit ECC)\";\n"
+"\"Better (4096-bit RSA)\" = \"Better (4096-bit RSA)\";\n"
 "\"Bhutan\" = \"Bhutan\";\n"
 "\"Bolivia (Plurinational State of)\" = \"Bolivien\";\n"
 "\"Bonaire, Sint Eustatius and Saba\" = \"Bonaire, Sint Eustatius und Saba\";\n"
@@ -164,7 +170,11 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Changes saved.\" = \"Änderungen gespeichert.\";\n"
 "\"Chile\" = \"Chile\";\n"
 "\"China\" = \"China\";\n"
+"\"Choose\" = \"Choose\";\n"
 "\"Christmas Island\" = \"Weihnachtsinsel\";\n"
+"\"City/Locality\" = \"City/Locality\";\n"
+"\"City/town name\" = \"City/town name\";\n"
+"\"Clients\" = \"Clients\";\n"
 "\"Cocos (Keeling) Islands\" = \"Kakao (Keeling) Inseln\";\n"
 "\"Colombia\" = \"Kolumbien\";\n"
 "\"Comoros\" = \"Komoren\";\n"
@@ -180,13 +190,16 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Contact\" = \"Kontakt\";\n"
 "\"Cook Islands\" = \"Cookinseln\";\n"
 "\"Costa Rica\" = \"Costa Rica\";\n"
+"\"Country or Region\" = \"Country or Region\";\n"
 "\"Create Certificate Signing Request\" = \"Erstellen Sie die Anfrage zur Bescheinigungsunterzeichnung\";\n"
 "\"Create New Certificate\" = \"Neues Zertifikat erstellen\";\n"
 "\"Create New TLS Certificate\" = \"Neues TLS-Zertifikat erstellen\";\n"
 "\"Create TLS Certificate Request\" = \"TLS erstellen Zertifikat Anfrage\";\n"
+"\"Creating TLS credentials, %d%% complete.\" = \"Creating TLS credentials, %d%% complete.\";\n"
 "\"Croatia\" = \"Kroatien\";\n"
 "\"Cuba\" = \"Kuba\";\n"
 "\"Curaçao\" = \"Curaao\";\n"
+"\"Current\" = \"Current\";\n"
 "\"Current Password\" = \"Aktuelles Passwort\";\n"
 "\"Custom Size\" = \"Benutzerdefinierte Größe\";\n"
 "\"Cyprus\" = \"Zypern\";\n"
@@ -202,6 +215,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Dominica\" = \"Dominica\";\n"
 "\"Dominican Republic\" = \"Dominikanische Republik\";\n"
 "\"Download Certificate Request File\" = \"Certificate Request File herunterladen\";\n"
+"\"EMail (contact)\" = \"EMail (contact)\";\n"
 "\"Ecuador\" = \"Ecuador\";\n"
 "\"Egypt\" = \"Ägypten\";\n"
 "\"El Salvador\" = \"El Salvador\";\n"
@@ -217,6 +231,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Faroe Islands\" = \"Färöer\";\n"
 "\"Fatal Errors/Conditions\" = \"Todesfehler/Bedingungen\";\n"
 "\"Fiji\" = \"Fidschi\";\n"
+"\"Filter\" = \"Filter\";\n"
 "\"Finland\" = \"Finnland\";\n"
 "\"France\" = \"Frankreich\";\n"
 "\"French Guiana\" = \"Französisch-Guayana\";\n"
@@ -228,6 +243,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Germany\" = \"Deutschland\";\n"
 "\"Ghana\" = \"Ghana\";\n"
 "\"Gibraltar\" = \"Gibraltar\";\n"
+"\"Good (2048-bit RSA)\" = \"Good (2048-bit RSA)\";\n"
 "\"Greece\" = \"Griechenland\";\n"
 "\"Greenland\" = \"Grünland\";\n"
 "\"Grenada\" = \"Grenada\";\n"
@@ -309,6 +325,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Mauritius\" = \"Mauritius\";\n"
 "\"Mayotte\" = \"Mayotte\";\n"
 "\"Media\" = \"Medien\";\n"
+"\"Memory Usage\" = \"Memory Usage\";\n"
 "\"Mexico\" = \"Mexiko\";\n"
 "\"Micronesia (Federated States of)\" = \"Mikronesien (Bundesstaaten)\";\n"
 "\"Missing action.\" = \"Missing Action.\";\n"
@@ -337,6 +354,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Niue\" = \"Nitrat\";\n"
 "\"No default printer set.\" = \"Kein Standarddruckersatz.\";\n"
 "\"No jobs in history.\" = \"Keine Jobs in der Geschichte.\";\n"
+"\"No matching printers.\" = \"No matching printers.\";\n"
 "\"Norfolk Island\" = \"Norfolk Island\";\n"
 "\"North Macedonia\" = \"Nordmakedonien\";\n"
 "\"Northern Mariana Islands\" = \"Nördliche Marianen\";\n"
@@ -347,6 +365,8 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Options:\" = \"Optionen:\";\n"
 "\"Organization\" = \"Organisation\";\n"
 "\"Organization Name\" = \"Name der Organisation\";\n"
+"\"Organization Unit\" = \"Organization Unit\";\n"
+"\"Organization/business name\" = \"Organization/business name\";\n"
 "\"Other Settings\" = \"Weitere Einstellungen\";\n"
 "\"Pakistan\" = \"Pakistan\";\n"
 "\"Palau\" = \"Palau\";\n"
@@ -359,6 +379,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\" = \"Passwort muss mindestens acht Zeichen lang sein und mindestens einen Großbuchstaben, einen Kleinbuchstaben und eine Ziffer enthalten.\";\n"
 "\"Passwords do not match.\" = \"Passwörter passen nicht.\";\n"
 "\"Pause Printing\" = \"Drucken\";\n"
+"\"Peak\" = \"Peak\";\n"
 "\"Peru\" = \"Peru\";\n"
 "\"Philippines\" = \"Philippinen\";\n"
 "\"Pitcairn\" = \"Pitcairn\";\n"
@@ -373,6 +394,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Print Group\" = \"Print Group\";\n"
 "\"Print Test Page\" = \"Testseite drucken\";\n"
 "\"Print job options:\" = \"Stellenangebote drucken:\";\n"
+"\"Printer Attributes\" = \"Printer Attributes\";\n"
 "\"Printer identified.\" = \"Drucker identifiziert.\";\n"
 "\"Printer is currently active.\" = \"Printer ist derzeit aktiv.\";\n"
 "\"Printer names must start with a letter or underscore and cannot contain special characters.\" = \"Druckernamen müssen mit einem Buchstaben oder Unterstrich beginnen und keine Sonderzeichen enthalten.\";\n"
@@ -385,8 +407,10 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Puerto Rico\" = \"Puerto Rico\";\n"
 "\"Qatar\" = \"Katar\";\n"
 "\"Queued at %s\" = \"Gefragt bei %s\";\n"
+"\"Raster Buffers\" = \"Raster Buffers\";\n"
 "\"Reprint Job\" = \"Reprint Job\";\n"
 "\"Rescan\" = \"Rind\";\n"
+"\"Resources\" = \"Resources\";\n"
 "\"Resume Printing\" = \"Verbrauchsdruck\";\n"
 "\"Reverse Landscape\" = \"Reverse Landschaft\";\n"
 "\"Reverse Portrait\" = \"Reverse Portrait\";\n"
@@ -416,6 +440,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Set Access Password\" = \"Passwort vergessen?\";\n"
 "\"Set as Default\" = \"Set als Standard\";\n"
 "\"Seychelles\" = \"Seychellen\";\n"
+"\"Show\" = \"Show\";\n"
 "\"Sierra Leone\" = \"Sierra Leone\";\n"
 "\"Singapore\" = \"Singapur\";\n"
 "\"Sint Maarten (Dutch part)\" = \"Sint Maarten (niederländischer Teil)\";\n"
@@ -430,8 +455,11 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Sri Lanka\" = \"Sri Lanka\";\n"
 "\"Started at %s\" = \"Gestartet bei %s\";\n"
 "\"State/Province\" = \"Staat/Provinz\";\n"
+"\"State/province name\" = \"State/province name\";\n"
 "\"Status\" = \"Status\";\n"
 "\"Sub-commands:\" = \"Unterbefehle:\";\n"
+"\"Subscriptions and Events\" = \"Subscriptions and Events\";\n"
+"\"Subsystem\" = \"Subsystem\";\n"
 "\"Sudan\" = \"Sudan\";\n"
 "\"Supplies\" = \"Lieferungen\";\n"
 "\"Suriname\" = \"Suriname\";\n"
@@ -451,6 +479,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Togo\" = \"Togo\";\n"
 "\"Tokelau\" = \"Tokelau\";\n"
 "\"Tonga\" = \"Tonga\";\n"
+"\"Total\" = \"Total\";\n"
 "\"Trinidad and Tobago\" = \"Trinidad und Tobago\";\n"
 "\"Tunisia\" = \"Tunesien\";\n"
 "\"Turkey\" = \"Türkei\";\n"
@@ -468,6 +497,7 @@ static const char *de_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Unable to join Wi-Fi network.\" = \"Unfähig, mit Wi-Fi-Netzwerk.\";\n"
 "\"Unable to lookup address.\" = \"Nicht zu suchen Adresse.\";\n"
 "\"Unable to use that driver.\" = \"Unfähig, diesen Fahrer zu benutzen.\";\n"
+"\"Unit, department, etc.\" = \"Unit, department, etc.\";\n"
 "\"United Arab Emirates\" = \"Vereinigte Arabische Emirate\";\n"
 "\"United Kingdom\" = \"Vereinigtes Königreich\";\n"
 "\"United Kingdom of Great Britain and Northern Ireland\" = \"Vereinigtes Königreich Großbritannien und Nordirland\";\n"
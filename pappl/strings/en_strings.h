@@ -1,4 +1,5 @@
-static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\" = \"  -a               Cancel all jobs (cancel).\";\n"
+static const char *en_strings = "\"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\" = \"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\";\n"
+"\"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\" = \"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\";\n"
 "\"  -c COPIES\" = \"  -c COPIES\";\n"
 "\"  -d PRINTER       Specify printer.\" = \"  -d PRINTER       Specify printer.\";\n"
 "\"  -j JOB-ID        Specify job ID (cancel).\" = \"  -j JOB-ID        Specify job ID (cancel).\";\n"
@@ -33,6 +34,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"  submit           Submit a file for printing.\" = \"  submit           Submit a file for printing.\";\n"
 "\"%d inches/sec\" = \"%d inches/sec\";\n"
 "\"%d job\" = \"%d job\";\n"
+"\"%d jobs\" = \"%d jobs\";\n"
 /* Media size in millimeters */
 "\"%d x %dmm\" = \"%d x %dmm\";\n"
 "\"%ddpi\" = \"%ddpi\";\n"
@@ -45,6 +47,8 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"%s (%s%s) from %s\" = \"%s (%s%s) from %s\";\n"
 /* Source/Tray Media */
 "\"%s Media\" = \"%s Media\";\n"
+/* PRINTER: STATE since DATE REASONS */
+"\"%s: %s since %s%s.\" = \"%s: %s since %s%s.\";\n"
 "\"%s: Bad 'server-port' value.\" = \"%s: Bad 'server-port' value.\";\n"
 "\"%s: Bad job ID.\" = \"%s: Bad job ID.\";\n"
 "\"%s: Bad printer URI '%s'.\" = \"%s: Bad printer URI '%s'.\";\n"
@@ -130,6 +134,8 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Belize\" = \"Belize\";\n"
 "\"Benin\" = \"Benin\";\n"
 "\"Bermuda\" = \"Bermuda\";\n"
+"\"Best (384-bit ECC)\" = \"Best (384-bit ECC)\";\n"
+"\"Better (4096-bit RSA)\" = \"Better (4096-bit RSA)\";\n"
 "\"Bhutan\" = \"Bhutan\";\n"
 "\"Bolivia (Plurinational State of)\" = \"Bolivia (Plurinational State of)\";\n"
 "\"Bonaire, Sint Eustatius and Saba\" = \"Bonaire, Sint Eustatius and Saba\";\n"
@@ -164,7 +170,11 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Changes saved.\" = \"Changes saved.\";\n"
 "\"Chile\" = \"Chile\";\n"
 "\"China\" = \"China\";\n"
+"\"Choose\" = \"Choose\";\n"
 "\"Christmas Island\" = \"Christmas Island\";\n"
+"\"City/Locality\" = \"City/Locality\";\n"
+"\"City/town name\" = \"City/town name\";\n"
+"\"Clients\" = \"Clients\";\n"
 "\"Cocos (Keeling) Islands\" = \"Cocos (Keeling) Islands\";\n"
 "\"Colombia\" = \"Colombia\";\n"
 "\"Comoros\" = \"Comoros\";\n"
@@ -180,13 +190,16 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Contact\" = \"Contact\";\n"
 "\"Cook Islands\" = \"Cook Islands\";\n"
 "\"Costa Rica\" = \"Costa Rica\";\n"
+"\"Country or Region\" = \"Country or Region\";\n"
 "\"Create Certificate Signing Request\" = \"Create Certificate Signing Request\";\n"
 "\"Create New Certificate\" = \"Create New Certificate\";\n"
 "\"Create New TLS Certificate\" = \"Create New TLS Certificate\";\n"
 "\"Create TLS Certificate Request\" = \"Create TLS Certificate Request\";\n"
+"\"Creating TLS credentials, %d%% complete.\" = \"Creating TLS credentials, %d%% complete.\";\n"
 "\"Croatia\" = \"Croatia\";\n"
 "\"Cuba\" = \"Cuba\";\n"
 "\"Curaçao\" = \"Curaçao\";\n"
+"\"Current\" = \"Current\";\n"
 "\"Current Password\" = \"Current Password\";\n"
 "\"Custom Size\" = \"Custom Size\";\n"
 "\"Cyprus\" = \"Cyprus\";\n"
@@ -202,6 +215,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Dominica\" = \"Dominica\";\n"
 "\"Dominican Republic\" = \"Dominican Republic\";\n"
 "\"Download Certificate Request File\" = \"Download Certificate Request File\";\n"
+"\"EMail (contact)\" = \"EMail (contact)\";\n"
 "\"Ecuador\" = \"Ecuador\";\n"
 "\"Egypt\" = \"Egypt\";\n"
 "\"El Salvador\" = \"El Salvador\";\n"
@@ -217,6 +231,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Faroe Islands\" = \"Faroe Islands\";\n"
 "\"Fatal Errors/Conditions\" = \"Fatal Errors/Conditions\";\n"
 "\"Fiji\" = \"Fiji\";\n"
+"\"Filter\" = \"Filter\";\n"
 "\"Finland\" = \"Finland\";\n"
 "\"France\" = \"France\";\n"
 "\"French Guiana\" = \"French Guiana\";\n"
@@ -228,6 +243,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Germany\" = \"Germany\";\n"
 "\"Ghana\" = \"Ghana\";\n"
 "\"Gibraltar\" = \"Gibraltar\";\n"
+"\"Good (2048-bit RSA)\" = \"Good (2048-bit RSA)\";\n"
 "\"Greece\" = \"Greece\";\n"
 "\"Greenland\" = \"Greenland\";\n"
 "\"Grenada\" = \"Grenada\";\n"
@@ -309,6 +325,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Mauritius\" = \"Mauritius\";\n"
 "\"Mayotte\" = \"Mayotte\";\n"
 "\"Media\" = \"Media\";\n"
+"\"Memory Usage\" = \"Memory Usage\";\n"
 "\"Mexico\" = \"Mexico\";\n"
 "\"Micronesia (Federated States of)\" = \"Micronesia (Federated States of)\";\n"
 "\"Missing action.\" = \"Missing action.\";\n"
@@ -337,6 +354,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Niue\" = \"Niue\";\n"
 "\"No default printer set.\" = \"No default printer set.\";\n"
 "\"No jobs in history.\" = \"No jobs in history.\";\n"
+"\"No matching printers.\" = \"No matching printers.\";\n"
 "\"Norfolk Island\" = \"Norfolk Island\";\n"
 "\"North Macedonia\" = \"North Macedonia\";\n"
 "\"Northern Mariana Islands\" = \"Northern Mariana Islands\";\n"
@@ -347,6 +365,8 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Options:\" = \"Options:\";\n"
 "\"Organization\" = \"Organization\";\n"
 "\"Organization Name\" = \"Organization Name\";\n"
+"\"Organization Unit\" = \"Organization Unit\";\n"
+"\"Organization/business name\" = \"Organization/business name\";\n"
 "\"Other Settings\" = \"Other Settings\";\n"
 "\"Pakistan\" = \"Pakistan\";\n"
 "\"Palau\" = \"Palau\";\n"
@@ -359,6 +379,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\" = \"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\";\n"
 "\"Passwords do not match.\" = \"Passwords do not match.\";\n"
 "\"Pause Printing\" = \"Pause Printing\";\n"
+"\"Peak\" = \"Peak\";\n"
 "\"Peru\" = \"Peru\";\n"
 "\"Philippines\" = \"Philippines\";\n"
 "\"Pitcairn\" = \"Pitcairn\";\n"
@@ -373,6 +394,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Print Group\" = \"Print Group\";\n"
 "\"Print Test Page\" = \"Print Test Page\";\n"
 "\"Print job options:\" = \"Print job options:\";\n"
+"\"Printer Attributes\" = \"Printer Attributes\";\n"
 "\"Printer identified.\" = \"Printer identified.\";\n"
 "\"Printer is currently active.\" = \"Printer is currently active.\";\n"
 "\"Printer names must start with a letter or underscore and cannot contain special characters.\" = \"Printer names must start with a letter or underscore and cannot contain special characters.\";\n"
@@ -385,8 +407,10 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Puerto Rico\" = \"Puerto Rico\";\n"
 "\"Qatar\" = \"Qatar\";\n"
 "\"Queued at %s\" = \"Queued at %s\";\n"
+"\"Raster Buffers\" = \"Raster Buffers\";\n"
 "\"Reprint Job\" = \"Reprint Job\";\n"
 "\"Rescan\" = \"Rescan\";\n"
+"\"Resources\" = \"Resources\";\n"
 "\"Resume Printing\" = \"Resume Printing\";\n"
 "\"Reverse Landscape\" = \"Reverse Landscape\";\n"
 "\"Reverse Portrait\" = \"Reverse Portrait\";\n"
@@ -416,6 +440,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Set Access Password\" = \"Set Access Password\";\n"
 "\"Set as Default\" = \"Set as Default\";\n"
 "\"Seychelles\" = \"Seychelles\";\n"
+"\"Show\" = \"Show\";\n"
 "\"Sierra Leone\" = \"Sierra Leone\";\n"
 "\"Singapore\" = \"Singapore\";\n"
 "\"Sint Maarten (Dutch part)\" = \"Sint Maarten (Dutch part)\";\n"
@@ -430,8 +455,11 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Sri Lanka\" = \"Sri Lanka\";\n"
 "\"Started at %s\" = \"Started at %s\";\n"
 "\"State/Province\" = \"State/Province\";\n"
+"\"State/province name\" = \"State/province name\";\n"
 "\"Status\" = \"Status\";\n"
 "\"Sub-commands:\" = \"Sub-commands:\";\n"
+"\"Subscriptions and Events\" = \"Subscriptions and Events\";\n"
+"\"Subsystem\" = \"Subsystem\";\n"
 "\"Sudan\" = \"Sudan\";\n"
 "\"Supplies\" = \"Supplies\";\n"
 "\"Suriname\" = \"Suriname\";\n"
@@ -451,6 +479,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Togo\" = \"Togo\";\n"
 "\"Tokelau\" = \"Tokelau\";\n"
 "\"Tonga\" = \"Tonga\";\n"
+"\"Total\" = \"Total\";\n"
 "\"Trinidad and Tobago\" = \"Trinidad and Tobago\";\n"
 "\"Tunisia\" = \"Tunisia\";\n"
 "\"Turkey\" = \"Turkey\";\n"
@@ -468,6 +497,7 @@ static const char *en_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Unable to join Wi-Fi network.\" = \"Unable to join Wi-Fi network.\";\n"
 "\"Unable to lookup address.\" = \"Unable to lookup address.\";\n"
 "\"Unable to use that driver.\" = \"Unable to use that driver.\";\n"
+"\"Unit, department, etc.\" = \"Unit, department, etc.\";\n"
 "\"United Arab Emirates\" = \"United Arab Emirates\";\n"
 "\"United Kingdom\" = \"United Kingdom\";\n"
 "\"United Kingdom of Great Britain and Northern Ireland\" = \"United Kingdom of Great Britain and Northern Ireland\";\n"
@@ -1,4 +1,5 @@
-static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\" = \"  -a               Cancelar todos los trabajos (cancel.)\";\n"
+static const char *es_strings = "\"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\" = \"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\";\n"
+"\"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\" = \"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\";\n"
 "\"  -c COPIES\" = \"-c COPIES\";\n"
 "\"  -d PRINTER       Specify printer.\" = \"  -d PRINTER       Especifique la impresora.\";\n"
 "\"  -j JOB-ID        Specify job ID (cancel).\" = \"  -j JOB-ID        Especifique el ID de trabajo (cancel.)\";\n"
@@ -33,6 +34,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"  submit           Submit a file for printing.\" = \"  submit           Enviar un archivo para imprimir.\";\n"
 "\"%d inches/sec\" = \"%d pulgadas/sec\";\n"
 "\"%d job\" = \"%d trabajo\";\n"
+"\"%d jobs\" = \"%d jobs\";\n"
 /* Media size in millimeters */
 "\"%d x %dmm\" = \"%d x %d mm\";\n"
 "\"%ddpi\" = \"%d dpi\";\n"
@@ -45,6 +47,8 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"%s (%s%s) from %s\" = \"%s (%s%s) de %s\";\n"
 /* Source/Tray Media */
 "\"%s Media\" = \"%s Media\";\n"
+/* PRINTER: STATE since DATE REASONS */
+"\"%s: %s since %s%s.\" = \"%s: %s since %s%s.\";\n"
 "\"%s: Bad 'server-port' value.\" = \"%s: Mal valor de puerto de servidor.\";\n"
 "\"%s: Bad job ID.\" = \"Mala identificación de trabajo.\";\n"
 "\"%s: Bad printer URI '%s'.\" = \"%s: Bad printer URI '%s'.\";\n"
@@ -130,6 +134,8 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Belize\" = \"Belice\";\n"
 "\"Benin\" = \"Benin\";\n"
 "\"Bermuda\" = \"Bermudas\";\n"
+"\"Best (384-bit ECC)\" = \"Best (384-bit ECC)\";\n"
+"\"Better (4096-bit RSA)\" = \"Better (4096-bit RSA)\";\n"
 "\"Bhutan\" = \"Bhután\";\n"
 "\"Bolivia (Plurinational State of)\" = \"Bolivia (Estado Plurinacional de)\";\n"
 "\"Bonaire, Sint Eustatius and Saba\" = \"Bonaire, Sint Eustatius y Saba\";\n"
@@ -164,7 +170,11 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Changes saved.\" = \"Cambios salvados.\";\n"
 "\"Chile\" = \"Chile\";\n"
 "\"China\" = \"China\";\n"
+"\"Choose\" = \"Choose\";\n"
 "\"Christmas Island\" = \"Isla de Navidad\";\n"
+"\"City/Locality\" = \"City/Locality\";\n"
+"\"City/town name\" = \"City/town name\";\n"
+"\"Clients\" = \"Clients\";\n"
 "\"Cocos (Keeling) Islands\" = \"Islas Cocos (Keeling)\";\n"
 "\"Colombia\" = \"Colombia\";\n"
 "\"Comoros\" = \"Comoras\";\n"
@@ -180,13 +190,16 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Contact\" = \"Contacto\";\n"
 "\"Cook Islands\" = \"Islas Cook\";\n"
 "\"Costa Rica\" = \"Costa Rica\";\n"
+"\"Country or Region\" = \"Country or Region\";\n"
 "\"Create Certificate Signing Request\" = \"Crear solicitud de registro de certificados\";\n"
 "\"Create New Certificate\" = \"Crear nuevo certificado\";\n"
 "\"Create New TLS Certificate\" = \"Crear nuevo certificado TLS\";\n"
 "\"Create TLS Certificate Request\" = \"Crear TLS Solicitud de certificado\";\n"
+"\"Creating TLS credentials, %d%% complete.\" = \"Creating TLS credentials, %d%% complete.\";\n"
 "\"Croatia\" = \"Croacia\";\n"
 "\"Cuba\" = \"Cuba\";\n"
 "\"Curaçao\" = \"Curaao\";\n"
+"\"Current\" = \"Current\";\n"
 "\"Current Password\" = \"Contraseña actual\";\n"
 "\"Custom Size\" = \"Tamaño personalizado\";\n"
 "\"Cyprus\" = \"Chipre\";\n"
@@ -202,6 +215,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Dominica\" = \"Dominica\";\n"
 "\"Dominican Republic\" = \"República Dominicana\";\n"
 "\"Download Certificate Request File\" = \"Descargar certificado Solicitar archivo\";\n"
+"\"EMail (contact)\" = \"EMail (contact)\";\n"
 "\"Ecuador\" = \"Ecuador\";\n"
 "\"Egypt\" = \"Egipto\";\n"
 "\"El Salvador\" = \"El Salvador\";\n"
@@ -217,6 +231,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Faroe Islands\" = \"Islas Feroe\";\n"
 "\"Fatal Errors/Conditions\" = \"Errores/Condiciones fatales\";\n"
 "\"Fiji\" = \"Fiji\";\n"
+"\"Filter\" = \"Filter\";\n"
 "\"Finland\" = \"Finlandia\";\n"
 "\"France\" = \"Francia\";\n"
 "\"French Guiana\" = \"Guayana Francesa\";\n"
@@ -228,6 +243,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Germany\" = \"Alemania\";\n"
 "\"Ghana\" = \"Ghana\";\n"
 "\"Gibraltar\" = \"Gibraltar\";\n"
+"\"Good (2048-bit RSA)\" = \"Good (2048-bit RSA)\";\n"
 "\"Greece\" = \"Grecia\";\n"
 "\"Greenland\" = \"Groenlandia\";\n"
 "\"Grenada\" = \"Granada\";\n"
@@ -309,6 +325,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Mauritius\" = \"Mauricio\";\n"
 "\"Mayotte\" = \"Mayotte\";\n"
 "\"Media\" = \"Media\";\n"
+"\"Memory Usage\" = \"Memory Usage\";\n"
 "\"Mexico\" = \"México\";\n"
 "\"Micronesia (Federated States of)\" = \"Micronesia (Estados Federados de)\";\n"
 "\"Missing action.\" = \"Falta de acción.\";\n"
@@ -337,6 +354,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Niue\" = \"Niue\";\n"
 "\"No default printer set.\" = \"No hay configuración de impresora predeterminada.\";\n"
 "\"No jobs in history.\" = \"No hay trabajos en la historia.\";\n"
+"\"No matching printers.\" = \"No matching printers.\";\n"
 "\"Norfolk Island\" = \"Norfolk Island\";\n"
 "\"North Macedonia\" = \"North Macedonia\";\n"
 "\"Northern Mariana Islands\" = \"Islas Marianas del Norte\";\n"
@@ -347,6 +365,8 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Options:\" = \"Opciones:\";\n"
 "\"Organization\" = \"Organización\";\n"
 "\"Organization Name\" = \"Nombre de la Organización\";\n"
+"\"Organization Unit\" = \"Organization Unit\";\n"
+"\"Organization/business name\" = \"Organization/business name\";\n"
 "\"Other Settings\" = \"Otras configuraciones\";\n"
 "\"Pakistan\" = \"Pakistán\";\n"
 "\"Palau\" = \"Palau\";\n"
@@ -359,6 +379,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\" = \"La contraseña debe tener al menos ocho caracteres de largo y contener al menos una letra mayúscula, una letra minúscula y un dígito.\";\n"
 "\"Passwords do not match.\" = \"Las contraseñas no coinciden.\";\n"
 "\"Pause Printing\" = \"Impresión de pausa\";\n"
+"\"Peak\" = \"Peak\";\n"
 "\"Peru\" = \"Perú\";\n"
 "\"Philippines\" = \"Philippines\";\n"
 "\"Pitcairn\" = \"Pitcairn\";\n"
@@ -373,6 +394,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Print Group\" = \"Print Group\";\n"
 "\"Print Test Page\" = \"Página de prueba de impresión\";\n"
 "\"Print job options:\" = \"Opciones de trabajo para imprimir:\";\n"
+"\"Printer Attributes\" = \"Printer Attributes\";\n"
 "\"Printer identified.\" = \"Impresora identificada.\";\n"
 "\"Printer is currently active.\" = \"La impresora está activa.\";\n"
 "\"Printer names must start with a letter or underscore and cannot contain special characters.\" = \"Los nombres de las impresoras deben comenzar con una letra o subrayar y no pueden contener caracteres especiales.\";\n"
@@ -385,8 +407,10 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Puerto Rico\" = \"Puerto Rico\";\n"
 "\"Qatar\" = \"Qatar\";\n"
 "\"Queued at %s\" = \"Queued at %s\";\n"
+"\"Raster Buffers\" = \"Raster Buffers\";\n"
 "\"Reprint Job\" = \"Reprint Job\";\n"
 "\"Rescan\" = \"Rescan\";\n"
+"\"Resources\" = \"Resources\";\n"
 "\"Resume Printing\" = \"Resume Printing\";\n"
 "\"Reverse Landscape\" = \"Paisaje inverso\";\n"
 "\"Reverse Portrait\" = \"Retrato inverso\";\n"
@@ -416,6 +440,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Set Access Password\" = \"Establecer contraseña\";\n"
 "\"Set as Default\" = \"Set as Default\";\n"
 "\"Seychelles\" = \"Seychelles\";\n"
+"\"Show\" = \"Show\";\n"
 "\"Sierra Leone\" = \"Sierra Leona\";\n"
 "\"Singapore\" = \"Singapur\";\n"
 "\"Sint Maarten (Dutch part)\" = \"Sint Maarten (parte holandesa)\";\n"
@@ -430,8 +455,11 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Sri Lanka\" = \"Sri Lanka\";\n"
 "\"Started at %s\" = \"Comenzó a %s\";\n"
 "\"State/Province\" = \"State/Province\";\n"
+"\"State/province name\" = \"State/province name\";\n"
 "\"Status\" = \"Situación\";\n"
 "\"Sub-commands:\" = \"Subcomandantes:\";\n"
+"\"Subscriptions and Events\" = \"Subscriptions and Events\";\n"
+"\"Subsystem\" = \"Subsystem\";\n"
 "\"Sudan\" = \"Sudán\";\n"
 "\"Supplies\" = \"Suministros\";\n"
 "\"Suriname\" = \"Suriname\";\n"
@@ -451,6 +479,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Togo\" = \"Togo\";\n"
 "\"Tokelau\" = \"Tokelau\";\n"
 "\"Tonga\" = \"Tonga\";\n"
+"\"Total\" = \"Total\";\n"
 "\"Trinidad and Tobago\" = \"Trinidad y Tabago\";\n"
 "\"Tunisia\" = \"Túnez\";\n"
 "\"Turkey\" = \"Turquía\";\n"
@@ -468,6 +497,7 @@ static const char *es_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Unable to join Wi-Fi network.\" = \"Incapaz de unirse a la red Wi-Fi.\";\n"
 "\"Unable to lookup address.\" = \"Incapaz de buscar la dirección.\";\n"
 "\"Unable to use that driver.\" = \"Incapaz de usar ese conductor.\";\n"
+"\"Unit, department, etc.\" = \"Unit, department, etc.\";\n"
 "\"United Arab Emirates\" = \"Emiratos Árabes Unidos\";\n"
 "\"United Kingdom\" = \"Reino Unido\";\n"
 "\"United Kingdom of Great Britain and Northern Ireland\" = \"Reino Unido de Gran Bretaña e Irlanda del Norte\";\n"
@@ -1,4 +1,5 @@
-static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\" = \"  -a               Annuler tous les emplois (cancel.)\";\n"
+static const char *fr_strings = "\"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\" = \"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\";\n"
+"\"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\" = \"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\";\n"
 "\"  -c COPIES\" = \"-c COPIES\";\n"
 "\"  -d PRINTER       Specify printer.\" = \"  -d PRINTER       Indiquez l'imprimante.\";\n"
 "\"  -j JOB-ID        Specify job ID (cancel).\" = \"  -j JOB-ID        Spécifier l'identité d'emploi (cancel).\";\n"
@@ -33,6 +34,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"  submit           Submit a file for printing.\" = \"  submit           Soumettre un fichier pour l'impression.\";\n"
 "\"%d inches/sec\" = \"%d pouces/sec\";\n"
 "\"%d job\" = \"Travail de F0\";\n"
+"\"%d jobs\" = \"%d jobs\";\n"
 /* Media size in millimeters */
 "\"%d x %dmm\" = \"%d x %d mm\";\n"
 "\"%ddpi\" = \"%d dpi\";\n"
@@ -45,6 +47,8 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"%s (%s%s) from %s\" = \"%s (%s%s) de %s\";\n"
 /* Source/Tray Media */
 "\"%s Media\" = \"%s Médias\";\n"
+/* PRINTER: STATE since DATE REASONS */
+"\"%s: %s since %s%s.\" = \"%s: %s since %s%s.\";\n"
 "\"%s: Bad 'server-port' value.\" = \"%s: Bad server-port value.\";\n"
 "\"%s: Bad job ID.\" = \"%s: Bad job ID.\";\n"
 "\"%s: Bad printer URI '%s'.\" = \"%s: Bad printer URI '%s'.\";\n"
@@ -130,6 +134,8 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Belize\" = \"Belize\";\n"
 "\"Benin\" = \"Bénin\";\n"
 "\"Bermuda\" = \"Bermudes\";\n"
+"\"Best (384-bit ECC)\" = \"Best (384-bit ECC)\";\n"
+"\"Better (4096-bit RSA)\" = \"Better (4096-bit RSA)\";\n"
 "\"Bhutan\" = \"Bhoutan\";\n"
 "\"Bolivia (Plurinational State of)\" = \"Bolivie (État plurinational de)\";\n"
 "\"Bonaire, Sint Eustatius and Saba\" = \"Bonaire, Sint Eustatius et Saba\";\n"
@@ -164,7 +170,11 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Changes saved.\" = \"Changements enregistrés.\";\n"
 "\"Chile\" = \"Chili\";\n"
 "\"China\" = \"Chine\";\n"
+"\"Choose\" = \"Choose\";\n"
 "\"Christmas Island\" = \"Christmas Island\";\n"
+"\"City/Locality\" = \"City/Locality\";\n"
+"\"City/town name\" = \"City/town name\";\n"
+"\"Clients\" = \"Clients\";\n"
 "\"Cocos (Keeling) Islands\" = \"Îles de Coco (Keeling)\";\n"
 "\"Colombia\" = \"Colombie\";\n"
 "\"Comoros\" = \"Comores\";\n"
@@ -180,13 +190,16 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Contact\" = \"Contact\";\n"
 "\"Cook Islands\" = \"Îles Cook\";\n"
 "\"Costa Rica\" = \"Costa Rica\";\n"
+"\"Country or Region\" = \"Country or Region\";\n"
 "\"Create Certificate Signing Request\" = \"Créer une demande de signature de certificat\";\n"
 "\"Create New Certificate\" = \"Créer un nouveau certificat\";\n"
 "\"Create New TLS Certificate\" = \"Créer un nouveau certificat TLS\";\n"
 "\"Create TLS Certificate Request\" = \"Créer TLS Demande de certificat\";\n"
+"\"Creating TLS credentials, %d%% complete.\" = \"Creating TLS credentials, %d%% complete.\";\n"
 "\"Croatia\" = \"Croatie\";\n"
 "\"Cuba\" = \"Cuba\";\n"
 "\"Curaçao\" = \"Curaao\";\n"
+"\"Current\" = \"Current\";\n"
 "\"Current Password\" = \"Mot de passe actuel\";\n"
 "\"Custom Size\" = \"Taille personnalisée\";\n"
 "\"Cyprus\" = \"Chypre\";\n"
@@ -202,6 +215,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Dominica\" = \"Dominique\";\n"
 "\"Dominican Republic\" = \"République dominicaine\";\n"
 "\"Download Certificate Request File\" = \"Télécharger le fichier Demande de certificat\";\n"
+"\"EMail (contact)\" = \"EMail (contact)\";\n"
 "\"Ecuador\" = \"Équateur\";\n"
 "\"Egypt\" = \"Égypte\";\n"
 "\"El Salvador\" = \"El Salvador\";\n"
@@ -217,6 +231,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Faroe Islands\" = \"Îles Féroé\";\n"
 "\"Fatal Errors/Conditions\" = \"Erreurs/Conditions Fatales\";\n"
 "\"Fiji\" = \"Fidji\";\n"
+"\"Filter\" = \"Filter\";\n"
 "\"Finland\" = \"Finlande\";\n"
 "\"France\" = \"France\";\n"
 "\"French Guiana\" = \"Guyane française\";\n"
@@ -228,6 +243,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Germany\" = \"Allemagne\";\n"
 "\"Ghana\" = \"Ghana\";\n"
 "\"Gibraltar\" = \"Gibraltar\";\n"
+"\"Good (2048-bit RSA)\" = \"Good (2048-bit RSA)\";\n"
 "\"Greece\" = \"Grèce\";\n"
 "\"Greenland\" = \"Groenland\";\n"
 "\"Grenada\" = \"Grenade\";\n"
@@ -309,6 +325,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Mauritius\" = \"Maurice\";\n"
 "\"Mayotte\" = \"Mayotte\";\n"
 "\"Media\" = \"Médias\";\n"
+"\"Memory Usage\" = \"Memory Usage\";\n"
 "\"Mexico\" = \"Mexique\";\n"
 "\"Micronesia (Federated States of)\" = \"Micronésie (États fédérés de)\";\n"
 "\"Missing action.\" = \"Manque d'action.\";\n"
@@ -337,6 +354,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Niue\" = \"Nioué\";\n"
 "\"No default printer set.\" = \"Aucun jeu d'imprimante par défaut.\";\n"
 "\"No jobs in history.\" = \"Pas de travail dans l'histoire.\";\n"
+"\"No matching printers.\" = \"No matching printers.\";\n"
 "\"Norfolk Island\" = \"Norfolk Island\";\n"
 "\"North Macedonia\" = \"Macédoine\";\n"
 "\"Northern Mariana Islands\" = \"Îles Mariannes du Nord\";\n"
@@ -347,6 +365,8 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Options:\" = \"Options:\";\n"
 "\"Organization\" = \"Organisation\";\n"
 "\"Organization Name\" = \"Nom de l ' Organisation\";\n"
+"\"Organization Unit\" = \"Organization Unit\";\n"
+"\"Organization/business name\" = \"Organization/business name\";\n"
 "\"Other Settings\" = \"Autres paramètres\";\n"
 "\"Pakistan\" = \"Pakistan\";\n"
 "\"Palau\" = \"Palaos\";\n"
@@ -359,6 +379,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\" = \"Le mot de passe doit avoir au moins huit caractères de long et contenir au moins une lettre majuscule, une lettre minuscule et un chiffre.\";\n"
 "\"Passwords do not match.\" = \"Les mots de passe ne correspondent pas.\";\n"
 "\"Pause Printing\" = \"Impression sur la douleur\";\n"
+"\"Peak\" = \"Peak\";\n"
 "\"Peru\" = \"Pérou\";\n"
 "\"Philippines\" = \"Philippines\";\n"
 "\"Pitcairn\" = \"Pitcairn\";\n"
@@ -373,6 +394,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Print Group\" = \"Groupe d ' impression\";\n"
 "\"Print Test Page\" = \"Page d ' essai\";\n"
 "\"Print job options:\" = \"Imprimer les options d'emploi:\";\n"
+"\"Printer Attributes\" = \"Printer Attributes\";\n"
 "\"Printer identified.\" = \"Imprimante identifiée.\";\n"
 "\"Printer is currently active.\" = \"L'imprimante est actuellement active.\";\n"
 "\"Printer names must start with a letter or underscore and cannot contain special characters.\" = \"Les noms d'imprimante doivent commencer par une lettre ou un soulignement et ne peuvent contenir des caractères spéciaux.\";\n"
@@ -385,8 +407,10 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Puerto Rico\" = \"Porto Rico\";\n"
 "\"Qatar\" = \"Qatar\";\n"
 "\"Queued at %s\" = \"Queued at %s\";\n"
+"\"Raster Buffers\" = \"Raster Buffers\";\n"
 "\"Reprint Job\" = \"Reprint Job\";\n"
 "\"Rescan\" = \"Rescan\";\n"
+"\"Resources\" = \"Resources\";\n"
 "\"Resume Printing\" = \"Récupérer l'impression\";\n"
 "\"Reverse Landscape\" = \"Paysage\";\n"
 "\"Reverse Portrait\" = \"Portrait\";\n"
@@ -416,6 +440,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Set Access Password\" = \"Set Access Password\";\n"
 "\"Set as Default\" = \"Par défaut\";\n"
 "\"Seychelles\" = \"Seychelles\";\n"
+"\"Show\" = \"Show\";\n"
 "\"Sierra Leone\" = \"Sierra Leone\";\n"
 "\"Singapore\" = \"Singapour\";\n"
 "\"Sint Maarten (Dutch part)\" = \"Sint Maarten (partie néerlandaise)\";\n"
@@ -430,8 +455,11 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Sri Lanka\" = \"Sri Lanka\";\n"
 "\"Started at %s\" = \"Démarré à %s\";\n"
 "\"State/Province\" = \"État/province\";\n"
+"\"State/province name\" = \"State/province name\";\n"
 "\"Status\" = \"État\";\n"
 "\"Sub-commands:\" = \"Sous-commandes :\";\n"
+"\"Subscriptions and Events\" = \"Subscriptions and Events\";\n"
+"\"Subsystem\" = \"Subsystem\";\n"
 "\"Sudan\" = \"Soudan\";\n"
 "\"Supplies\" = \"Fournitures\";\n"
 "\"Suriname\" = \"Suriname\";\n"
@@ -451,6 +479,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Togo\" = \"Togo\";\n"
 "\"Tokelau\" = \"Tokélaou\";\n"
 "\"Tonga\" = \"Tonga\";\n"
+"\"Total\" = \"Total\";\n"
 "\"Trinidad and Tobago\" = \"Trinité-et-Tobago\";\n"
 "\"Tunisia\" = \"Tunisie\";\n"
 "\"Turkey\" = \"Turquie\";\n"
@@ -468,6 +497,7 @@ static const char *fr_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Unable to join Wi-Fi network.\" = \"Impossible de rejoindre le réseau Wi-Fi.\";\n"
 "\"Unable to lookup address.\" = \"Incapable de regarder l'adresse.\";\n"
 "\"Unable to use that driver.\" = \"Incapable d'utiliser ce conducteur.\";\n"
+"\"Unit, department, etc.\" = \"Unit, department, etc.\";\n"
 "\"United Arab Emirates\" = \"Émirats arabes unis\";\n"
 "\"United Kingdom\" = \"Royaume-Uni\";\n"
 "\"United Kingdom of Great Britain and Northern Ireland\" = \"Royaume-Uni de Grande-Bretagne et d ' Irlande du Nord\";\n"
@@ -1,4 +1,5 @@
-static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\" = \"  -a               Annulla tutti i lavori (cancella.)\";\n"
+static const char *it_strings = "\"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\" = \"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\";\n"
+"\"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\" = \"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\";\n"
 "\"  -c COPIES\" = \"-c COP\";\n"
 "\"  -d PRINTER       Specify printer.\" = \"  -d PRINTER       Specifica la stampante.\";\n"
 "\"  -j JOB-ID        Specify job ID (cancel).\" = \"  -j JOB-ID        Specificare l'ID del lavoro (cancel.)\";\n"
@@ -33,6 +34,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"  submit           Submit a file for printing.\" = \"  submit           inviare un file per la stampa.\";\n"
 "\"%d inches/sec\" = \"%d pollici/sec\";\n"
 "\"%d job\" = \"%d lavoro\";\n"
+"\"%d jobs\" = \"%d jobs\";\n"
 /* Media size in millimeters */
 "\"%d x %dmm\" = \"%d x %d mm\";\n"
 "\"%ddpi\" = \"%d dpi\";\n"
@@ -45,6 +47,8 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"%s (%s%s) from %s\" = \"%s (%s%s) da %s\";\n"
 /* Source/Tray Media */
 "\"%s Media\" = \"%s Media\";\n"
+/* PRINTER: STATE since DATE REASONS */
+"\"%s: %s since %s%s.\" = \"%s: %s since %s%s.\";\n"
 "\"%s: Bad 'server-port' value.\" = \"%s: Bad server-port value.\";\n"
 "\"%s: Bad job ID.\" = \"Bad job ID.\";\n"
 "\"%s: Bad printer URI '%s'.\" = \"%s: Scarsa URI stampante ' %s '.\";\n"
@@ -130,6 +134,8 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Belize\" = \"Belize\";\n"
 "\"Benin\" = \"Benin\";\n"
 "\"Bermuda\" = \"Bermuda\";\n"
+"\"Best (384-bit ECC)\" = \"Best (384-bit ECC)\";\n"
+"\"Better (4096-bit RSA)\" = \"Better (4096-bit RSA)\";\n"
 "\"Bhutan\" = \"Bhutan\";\n"
 "\"Bolivia (Plurinational State of)\" = \"Bolivia (Stato nazionale)\";\n"
 "\"Bonaire, Sint Eustatius and Saba\" = \"Bonaire, Sint Eustatius e Saba\";\n"
@@ -164,7 +170,11 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Changes saved.\" = \"Cambiamenti salvati.\";\n"
 "\"Chile\" = \"Cile\";\n"
 "\"China\" = \"Cina\";\n"
+"\"Choose\" = \"Choose\";\n"
 "\"Christmas Island\" = \"Isola di Natale\";\n"
+"\"City/Locality\" = \"City/Locality\";\n"
+"\"City/town name\" = \"City/town name\";\n"
+"\"Clients\" = \"Clients\";\n"
 "\"Cocos (Keeling) Islands\" = \"Isole Cocos (Keeling)\";\n"
 "\"Colombia\" = \"Colombia\";\n"
 "\"Comoros\" = \"Comore\";\n"
@@ -180,13 +190,16 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Contact\" = \"Contatto\";\n"
 "\"Cook Islands\" = \"Isole Cook\";\n"
 "\"Costa Rica\" = \"Costa Rica\";\n"
+"\"Country or Region\" = \"Country or Region\";\n"
 "\"Create Certificate Signing Request\" = \"Crea richiesta di firma del certificato\";\n"
 "\"Create New Certificate\" = \"Crea nuovo certificato\";\n"
 "\"Create New TLS Certificate\" = \"Crea nuovo certificato TLS\";\n"
 "\"Create TLS Certificate Request\" = \"Creare TLS Richiesta certificato\";\n"
+"\"Creating TLS credentials, %d%% complete.\" = \"Creating TLS credentials, %d%% complete.\";\n"
 "\"Croatia\" = \"Croazia\";\n"
 "\"Cuba\" = \"Cuba\";\n"
 "\"Curaçao\" = \"Curaa\";\n"
+"\"Current\" = \"Current\";\n"
 "\"Current Password\" = \"Password corrente\";\n"
 "\"Custom Size\" = \"Dimensione personalizzata\";\n"
 "\"Cyprus\" = \"Cipro\";\n"
@@ -202,6 +215,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Dominica\" = \"Dominica\";\n"
 "\"Dominican Republic\" = \"Repubblica Dominicana\";\n"
 "\"Download Certificate Request File\" = \"Scarica il file di richiesta del certificato\";\n"
+"\"EMail (contact)\" = \"EMail (contact)\";\n"
 "\"Ecuador\" = \"Ecuador\";\n"
 "\"Egypt\" = \"Egitto\";\n"
 "\"El Salvador\" = \"El Salvador\";\n"
@@ -217,6 +231,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Faroe Islands\" = \"Isole Faroe\";\n"
 "\"Fatal Errors/Conditions\" = \"Errori/Condizioni\";\n"
 "\"Fiji\" = \"Fiji\";\n"
+"\"Filter\" = \"Filter\";\n"
 "\"Finland\" = \"Finlandia\";\n"
 "\"France\" = \"Francia\";\n"
 "\"French Guiana\" = \"Guiana francese\";\n"
@@ -228,6 +243,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Germany\" = \"Germania\";\n"
 "\"Ghana\" = \"Ghana\";\n"
 "\"Gibraltar\" = \"Gibilterra\";\n"
+"\"Good (2048-bit RSA)\" = \"Good (2048-bit RSA)\";\n"
 "\"Greece\" = \"Grecia\";\n"
 "\"Greenland\" = \"Groenlandia\";\n"
 "\"Grenada\" = \"Grenada\";\n"
@@ -309,6 +325,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Mauritius\" = \"Mauritius\";\n"
 "\"Mayotte\" = \"Mayotte\";\n"
 "\"Media\" = \"Media\";\n"
+"\"Memory Usage\" = \"Memory Usage\";\n"
 "\"Mexico\" = \"Messico\";\n"
 "\"Micronesia (Federated States of)\" = \"Micronesia (Stati federali)\";\n"
 "\"Missing action.\" = \"Azione mancante.\";\n"
@@ -337,6 +354,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Niue\" = \"Niue\";\n"
 "\"No default printer set.\" = \"Nessuna stampante predefinita impostata.\";\n"
 "\"No jobs in history.\" = \"Nessun lavoro nella storia.\";\n"
+"\"No matching printers.\" = \"No matching printers.\";\n"
 "\"Norfolk Island\" = \"Isola di Norfolk\";\n"
 "\"North Macedonia\" = \"Macedonia settentrionale\";\n"
 "\"Northern Mariana Islands\" = \"Isole Marianne Settentrionali\";\n"
@@ -347,6 +365,8 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Options:\" = \"Opzioni:\";\n"
 "\"Organization\" = \"Organizzazione\";\n"
 "\"Organization Name\" = \"Nome dell'organizzazione\";\n"
+"\"Organization Unit\" = \"Organization Unit\";\n"
+"\"Organization/business name\" = \"Organization/business name\";\n"
 "\"Other Settings\" = \"Altre impostazioni\";\n"
 "\"Pakistan\" = \"Pakistan\";\n"
 "\"Palau\" = \"Palau\";\n"
@@ -359,6 +379,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\" = \"La password deve essere lunga almeno otto caratteri e contenere almeno una lettera maiuscola, una lettera minuscola e una cifra.\";\n"
 "\"Passwords do not match.\" = \"Le password non corrispondono.\";\n"
 "\"Pause Printing\" = \"Stampa Pausa\";\n"
+"\"Peak\" = \"Peak\";\n"
 "\"Peru\" = \"Perù\";\n"
 "\"Philippines\" = \"Filippine\";\n"
 "\"Pitcairn\" = \"Pitcairn\";\n"
@@ -373,6 +394,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Print Group\" = \"Gruppo di stampa\";\n"
 "\"Print Test Page\" = \"Pagina di test di stampa\";\n"
 "\"Print job options:\" = \"Stampa opzioni di lavoro:\";\n"
+"\"Printer Attributes\" = \"Printer Attributes\";\n"
 "\"Printer identified.\" = \"Stampante identificata.\";\n"
 "\"Printer is currently active.\" = \"La stampante è attualmente attiva.\";\n"
 "\"Printer names must start with a letter or underscore and cannot contain special characters.\" = \"I nomi della stampante devono iniziare con una lettera o un sottoscopo e non possono contenere caratteri speciali.\";\n"
@@ -385,8 +407,10 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Puerto Rico\" = \"Porto Rico\";\n"
 "\"Qatar\" = \"Qatar\";\n"
 "\"Queued at %s\" = \"Condividi su %s\";\n"
+"\"Raster Buffers\" = \"Raster Buffers\";\n"
 "\"Reprint Job\" = \"Ristampa lavoro\";\n"
 "\"Rescan\" = \"Rescan\";\n"
+"\"Resources\" = \"Resources\";\n"
 "\"Resume Printing\" = \"Riprendi la stampa\";\n"
 "\"Reverse Landscape\" = \"Paesaggio inverso\";\n"
 "\"Reverse Portrait\" = \"Ritratto inverso\";\n"
@@ -416,6 +440,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Set Access Password\" = \"Impostare la password di accesso\";\n"
 "\"Set as Default\" = \"Impostare come predefinito\";\n"
 "\"Seychelles\" = \"Seychelles\";\n"
+"\"Show\" = \"Show\";\n"
 "\"Sierra Leone\" = \"Sierra Leone\";\n"
 "\"Singapore\" = \"Singapore\";\n"
 "\"Sint Maarten (Dutch part)\" = \"Sint Maarten (parte olandese)\";\n"
@@ -430,8 +455,11 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Sri Lanka\" = \"Sri Lanka\";\n"
 "\"Started at %s\" = \"Iniziato da %s\";\n"
 "\"State/Province\" = \"Stato/Provincia\";\n"
+"\"State/province name\" = \"State/province name\";\n"
 "\"Status\" = \"Stato\";\n"
 "\"Sub-commands:\" = \"Sottocomandi:\";\n"
+"\"Subscriptions and Events\" = \"Subscriptions and Events\";\n"
+"\"Subsystem\" = \"Subsystem\";\n"
 "\"Sudan\" = \"Sudan\";\n"
 "\"Supplies\" = \"Forniture\";\n"
 "\"Suriname\" = \"Suriname\";\n"
@@ -451,6 +479,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Togo\" = \"Togo\";\n"
 "\"Tokelau\" = \"Tokelau\";\n"
 "\"Tonga\" = \"Tonga\";\n"
+"\"Total\" = \"Total\";\n"
 "\"Trinidad and Tobago\" = \"Trinidad e Tobago\";\n"
 "\"Tunisia\" = \"Tunisia\";\n"
 "\"Turkey\" = \"Turchia\";\n"
@@ -468,6 +497,7 @@ static const char *it_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Unable to join Wi-Fi network.\" = \"Non è possibile accedere alla rete Wi-Fi.\";\n"
 "\"Unable to lookup address.\" = \"Non riesco a cercare l'indirizzo.\";\n"
 "\"Unable to use that driver.\" = \"Non riesco a usare quel conducente.\";\n"
+"\"Unit, department, etc.\" = \"Unit, department, etc.\";\n"
 "\"United Arab Emirates\" = \"Emirati Arabi Uniti\";\n"
 "\"United Kingdom\" = \"Regno Unito\";\n"
 "\"United Kingdom of Great Britain and Northern Ireland\" = \"Regno Unito di Gran Bretagna e Irlanda del Nord\";\n"
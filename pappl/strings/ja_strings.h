@@ -1,4 +1,5 @@
-static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\" = \"  -a すべてのジョブをキャンセル (cancel)\";\n"
+static const char *ja_strings = "\"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\" = \"                   Use output-format=tsv for tab-separated output (jobs,printers,status).\";\n"
+"\"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\" = \"  -a               Cancel all jobs (cancel) or show all printers (jobs,status).\";\n"
 "\"  -c COPIES\" = \"  -c コピー\";\n"
 "\"  -d PRINTER       Specify printer.\" = \"  -dプリンターを指定する\";\n"
 "\"  -j JOB-ID        Specify job ID (cancel).\" = \"  -j JOB-ID ジョブ ID (cancel) を指定します。\";\n"
@@ -33,6 +34,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"  submit           Submit a file for printing.\" = \"  submit 印刷用のファイルを提出してください。\";\n"
 "\"%d inches/sec\" = \"%dインチ/秒\";\n"
 "\"%d job\" = \"%d ジョブ\";\n"
+"\"%d jobs\" = \"%d jobs\";\n"
 /* Media size in millimeters */
 "\"%d x %dmm\" = \"%d x %d mm\";\n"
 "\"%ddpi\" = \"%dのdpi\";\n"
@@ -45,6 +47,8 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"%s (%s%s) from %s\" = \"%s (%s%s) から %s\";\n"
 /* Source/Tray Media */
 "\"%s Media\" = \"%s メディア\";\n"
+/* PRINTER: STATE since DATE REASONS */
+"\"%s: %s since %s%s.\" = \"%s: %s since %s%s.\";\n"
 "\"%s: Bad 'server-port' value.\" = \"%s: 悪いサーバーポート値。\";\n"
 "\"%s: Bad job ID.\" = \"%s: 不良ジョブID\";\n"
 "\"%s: Bad printer URI '%s'.\" = \"%s: 悪いプリンター URI '%s'.\";\n"
@@ -130,6 +134,8 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Belize\" = \"ベリーズ\";\n"
 "\"Benin\" = \"ログイン\";\n"
 "\"Bermuda\" = \"バーミューダ\";\n"
+"\"Best (384-bit ECC)\" = \"Best (384-bit ECC)\";\n"
+"\"Better (4096-bit RSA)\" = \"Better (4096-bit RSA)\";\n"
 "\"Bhutan\" = \"ブータン\";\n"
 "\"Bolivia (Plurinational State of)\" = \"ボリビア(国)\";\n"
 "\"Bonaire, Sint Eustatius and Saba\" = \"ボネール、シント・ユースタチウス、サバ\";\n"
@@ -164,7 +170,11 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Changes saved.\" = \"保存された変更。\";\n"
 "\"Chile\" = \"チリ\";\n"
 "\"China\" = \"中国の\";\n"
+"\"Choose\" = \"Choose\";\n"
 "\"Christmas Island\" = \"クリスマス島\";\n"
+"\"City/Locality\" = \"City/Locality\";\n"
+"\"City/town name\" = \"City/town name\";\n"
+"\"Clients\" = \"Clients\";\n"
 "\"Cocos (Keeling) Islands\" = \"ココス諸島(ケイリング)\";\n"
 "\"Colombia\" = \"コロンビア\";\n"
 "\"Comoros\" = \"コモロ\";\n"
@@ -180,13 +190,16 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Contact\" = \"お問い合わせ\";\n"
 "\"Cook Islands\" = \"クック諸島\";\n"
 "\"Costa Rica\" = \"コスタリカ\";\n"
+"\"Country or Region\" = \"Country or Region\";\n"
 "\"Create Certificate Signing Request\" = \"証明書署名リクエストを作成する\";\n"
 "\"Create New Certificate\" = \"新しい証明書を作成する\";\n"
 "\"Create New TLS Certificate\" = \"新しい TLS 証明書を作成する\";\n"
 "\"Create TLS Certificate Request\" = \"TLS の作成 証明書の要求\";\n"
+"\"Creating TLS credentials, %d%% complete.\" = \"Creating TLS credentials, %d%% complete.\";\n"
 "\"Croatia\" = \"クロアチア\";\n"
 "\"Cuba\" = \"キューバ\";\n"
 "\"Curaçao\" = \"キュラオ\";\n"
+"\"Current\" = \"Current\";\n"
 "\"Current Password\" = \"現在のパスワード\";\n"
 "\"Custom Size\" = \"注文のサイズ\";\n"
 "\"Cyprus\" = \"キプロス\";\n"
@@ -202,6 +215,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Dominica\" = \"ドミニカ\";\n"
 "\"Dominican Republic\" = \"ドミニカ共和国\";\n"
 "\"Download Certificate Request File\" = \"証明書の要求ファイルのダウンロード\";\n"
+"\"EMail (contact)\" = \"EMail (contact)\";\n"
 "\"Ecuador\" = \"エクアドル\";\n"
 "\"Egypt\" = \"エジプト\";\n"
 "\"El Salvador\" = \"エルサルバドール\";\n"
@@ -217,6 +231,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Faroe Islands\" = \"フェロー諸島\";\n"
 "\"Fatal Errors/Conditions\" = \"致命的な間違い/条件\";\n"
 "\"Fiji\" = \"フィジー\";\n"
+"\"Filter\" = \"Filter\";\n"
 "\"Finland\" = \"フィンランド\";\n"
 "\"France\" = \"フランス\";\n"
 "\"French Guiana\" = \"フランスのガイアナ\";\n"
@@ -228,6 +243,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Germany\" = \"ドイツ\";\n"
 "\"Ghana\" = \"ガーナ\";\n"
 "\"Gibraltar\" = \"ジブラルタル\";\n"
+"\"Good (2048-bit RSA)\" = \"Good (2048-bit RSA)\";\n"
 "\"Greece\" = \"ギリシャ\";\n"
 "\"Greenland\" = \"グリーンランド\";\n"
 "\"Grenada\" = \"グレナダ\";\n"
@@ -309,6 +325,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Mauritius\" = \"モーリシャス\";\n"
 "\"Mayotte\" = \"マヨッテ\";\n"
 "\"Media\" = \"メディア\";\n"
+"\"Memory Usage\" = \"Memory Usage\";\n"
 "\"Mexico\" = \"メキシコ\";\n"
 "\"Micronesia (Federated States of)\" = \"マイクロネシア(連邦)\";\n"
 "\"Missing action.\" = \"行動を欠く。\";\n"
@@ -337,6 +354,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Niue\" = \"ログイン\";\n"
 "\"No default printer set.\" = \"デフォルトのプリンタセットはありません。\";\n"
 "\"No jobs in history.\" = \"履歴のジョブはありません。\";\n"
+"\"No matching printers.\" = \"No matching printers.\";\n"
 "\"Norfolk Island\" = \"ノーフォーク島\";\n"
 "\"North Macedonia\" = \"北マケドニア\";\n"
 "\"Northern Mariana Islands\" = \"北マリアナ諸島\";\n"
@@ -347,6 +365,8 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Options:\" = \"オプション:\";\n"
 "\"Organization\" = \"社会招聘\";\n"
 "\"Organization Name\" = \"組織名称\";\n"
+"\"Organization Unit\" = \"Organization Unit\";\n"
+"\"Organization/business name\" = \"Organization/business name\";\n"
 "\"Other Settings\" = \"その他の設定\";\n"
 "\"Pakistan\" = \"パキスタン\";\n"
 "\"Palau\" = \"パラオ\";\n"
@@ -359,6 +379,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Password must be at least eight characters long and contain at least one uppercase letter, one lowercase letter, and one digit.\" = \"パスワードは、少なくとも8文字以上で、少なくとも1つの大文字、小文字、および1つの数字を含む必要があります。\";\n"
 "\"Passwords do not match.\" = \"パスワードは一致しません。\";\n"
 "\"Pause Printing\" = \"ペーパー印刷\";\n"
+"\"Peak\" = \"Peak\";\n"
 "\"Peru\" = \"ペルー\";\n"
 "\"Philippines\" = \"フィリピン\";\n"
 "\"Pitcairn\" = \"ピッツケアン\";\n"
@@ -373,6 +394,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Print Group\" = \"プリントグループ\";\n"
 "\"Print Test Page\" = \"プリントテストページ\";\n"
 "\"Print job options:\" = \"ジョブオプションを印刷:\";\n"
+"\"Printer Attributes\" = \"Printer Attributes\";\n"
 "\"Printer identified.\" = \"識別されるプリンター。\";\n"
 "\"Printer is currently active.\" = \"プリンターは現在有効です。\";\n"
 "\"Printer names must start with a letter or underscore and cannot contain special characters.\" = \"プリンター名は、文字またはアンダースコアで始まり、特別な文字を含むことはできません。\";\n"
@@ -385,8 +407,10 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Puerto Rico\" = \"プエルトリコ\";\n"
 "\"Qatar\" = \"カタール\";\n"
 "\"Queued at %s\" = \"%sでキューイング\";\n"
+"\"Raster Buffers\" = \"Raster Buffers\";\n"
 "\"Reprint Job\" = \"再印刷ジョブ\";\n"
 "\"Rescan\" = \"リスカ\";\n"
+"\"Resources\" = \"Resources\";\n"
 "\"Resume Printing\" = \"再開の印刷\";\n"
 "\"Reverse Landscape\" = \"逆の風景\";\n"
 "\"Reverse Portrait\" = \"逆の肖像\";\n"
@@ -416,6 +440,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Set Access Password\" = \"アクセスパスワードを設定する\";\n"
 "\"Set as Default\" = \"デフォルトで設定\";\n"
 "\"Seychelles\" = \"セイシェル\";\n"
+"\"Show\" = \"Show\";\n"
 "\"Sierra Leone\" = \"シエラレオネ\";\n"
 "\"Singapore\" = \"シンガポール\";\n"
 "\"Sint Maarten (Dutch part)\" = \"シント・マールテン(オランダ)\";\n"
@@ -430,8 +455,11 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Sri Lanka\" = \"スリランカ\";\n"
 "\"Started at %s\" = \"開始 %s\";\n"
 "\"State/Province\" = \"都道府県/都道府県\";\n"
+"\"State/province name\" = \"State/province name\";\n"
 "\"Status\" = \"ステータス\";\n"
 "\"Sub-commands:\" = \"サブコマンド:\";\n"
+"\"Subscriptions and Events\" = \"Subscriptions and Events\";\n"
+"\"Subsystem\" = \"Subsystem\";\n"
 "\"Sudan\" = \"スーダン\";\n"
 "\"Supplies\" = \"アクセサリー\";\n"
 "\"Suriname\" = \"スリナム\";\n"
@@ -451,6 +479,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Togo\" = \"トーゴ\";\n"
 "\"Tokelau\" = \"トケラウ\";\n"
 "\"Tonga\" = \"トンガ\";\n"
+"\"Total\" = \"Total\";\n"
 "\"Trinidad and Tobago\" = \"トリニダードとトバゴ\";\n"
 "\"Tunisia\" = \"チュニジア\";\n"
 "\"Turkey\" = \"トルコ\";\n"
@@ -468,6 +497,7 @@ static const char *ja_strings = "\"  -a               Cancel all jobs (cancel).\
 "\"Unable to join Wi-Fi network.\" = \"Wi-Fiネットワークへの参加はできません。\";\n"
 "\"Unable to lookup address.\" = \"アドレスを調べることができません。\";\n"
 "\"Unable to use that driver.\" = \"そのドライバを使用できません。\";\n"
+"\"Unit, department, etc.\" = \"Unit, department, etc.\";\n"
 "\"United Arab Emirates\" = \"アラブ首長国連邦\";\n"
 "\"United Kingdom\" = \"イギリス\";\n"
 "\"United Kingdom of Great Britain and Northern Ireland\" = \"イギリス・北アイルランド王国\";\n"
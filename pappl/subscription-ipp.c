@@ -98,7 +98,7 @@ _papplSubscriptionIPPCreate(
     // Get the job target for the subscription...
     int	job_id;				// Job ID
 
-    if ((attr = ippFindAttribute(client->request, "notify-job-id", IPP_TAG_ZERO)) == NULL)
+    if ((attr = _papplClientFindAttribute(client, "notify-job-id", IPP_TAG_ZERO)) == NULL)
     {
       papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing \"notify-job-id\" attribute.");
       return;
@@ -122,7 +122,7 @@ _papplSubscriptionIPPCreate(
 
   if (client->username[0])
     username = client->username;
-  else if ((username = ippGetString(ippFindAttribute(client->request, "requesting-user-name", IPP_TAG_NAME), 0, NULL)) == NULL)
+  else if ((username = ippGetString(_papplClientFindAttribute(client, "requesting-user-name", IPP_TAG_NAME), 0, NULL)) == NULL)
     username = "anonymous";
 
   // Skip past the initial attributes to the first subscription group.
@@ -352,15 +352,15 @@ _papplSubscriptionIPPGetNotifications(
   }
 
   // Get request attributes...
-  if ((sub_ids = ippFindAttribute(client->request, "notify-subscription-ids", IPP_TAG_INTEGER)) == NULL)
+  if ((sub_ids = _papplClientFindAttribute(client, "notify-subscription-ids", IPP_TAG_INTEGER)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing \"notify-subscription-ids\" attribute.");
     return;
   }
 
   count       = ippGetCount(sub_ids);
-  seq_nums    = ippFindAttribute(client->request, "notify-sequence-numbers", IPP_TAG_INTEGER);
-  notify_wait = ippGetBoolean(ippFindAttribute(client->request, "notify-wait", IPP_TAG_BOOLEAN), 0);
+  seq_nums    = _papplClientFindAttribute(client, "notify-sequence-numbers", IPP_TAG_INTEGER);
+  notify_wait = ippGetBoolean(_papplClientFindAttribute(client, "notify-wait", IPP_TAG_BOOLEAN), 0);
 
   if (seq_nums && count != ippGetCount(seq_nums))
   {
@@ -485,14 +485,14 @@ _papplSubscriptionIPPList(
   }
 
   // Get request attributes...
-  job_id  = ippGetInteger(ippFindAttribute(client->request, "notify-job-id", IPP_TAG_INTEGER), 0);
-  limit   = ippGetInteger(ippFindAttribute(client->request, "limit", IPP_TAG_INTEGER), 0);
-  my_subs = ippGetBoolean(ippFindAttribute(client->request, "my-subscriptions", IPP_TAG_BOOLEAN), 0);
+  job_id  = ippGetInteger(_papplClientFindAttribute(client, "notify-job-id", IPP_TAG_INTEGER), 0);
+  limit   = ippGetInteger(_papplClientFindAttribute(client, "limit", IPP_TAG_INTEGER), 0);
+  my_subs = ippGetBoolean(_papplClientFindAttribute(client, "my-subscriptions", IPP_TAG_BOOLEAN), 0);
   ra      = ippCreateRequestedArray(client->request);
 
   if (client->username[0])
     username = client->username;
-  else if ((username = ippGetString(ippFindAttribute(client->request, "requesting-user-name", IPP_TAG_NAME), 0, NULL)) == NULL)
+  else if ((username = ippGetString(_papplClientFindAttribute(client, "requesting-user-name", IPP_TAG_NAME), 0, NULL)) == NULL)
     username = "anonymous";
 
   papplClientRespondIPP(client, IPP_STATUS_OK, NULL);
@@ -559,7 +559,7 @@ _papplSubscriptionIPPRenew(
     return;
 
   // Renew it...
-  if ((attr = ippFindAttribute(client->request, "notify-lease-duration", IPP_TAG_ZERO)) == NULL)
+  if ((attr = _papplClientFindAttribute(client, "notify-lease-duration", IPP_TAG_ZERO)) == NULL)
   {
     lease = PAPPL_LEASE_DEFAULT;
   }
@@ -586,7 +586,7 @@ find_subscription(
   pappl_subscription_t	*sub;		// Subscription
 
 
-  if ((sub_id = ippFindAttribute(client->request, "notify-subscription-id", IPP_TAG_ZERO)) == NULL)
+  if ((sub_id = _papplClientFindAttribute(client, "notify-subscription-id", IPP_TAG_ZERO)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing \"notify-subscription-id\" attribute.");
     return (NULL);
@@ -32,6 +32,7 @@ extern "C" {
 struct _pappl_subscription_s		// Subscription data
 {
   pthread_rwlock_t	rwlock;			// Reader/writer lock
+  pappl_system_t	*system;		// Containing system
   int			subscription_id;	// Subscription ID
   pappl_event_t		mask;			// IPP "notifiy-events" bit field
   pappl_printer_t	*printer;		// Printer, if any
@@ -46,6 +47,7 @@ struct _pappl_subscription_s		// Subscription data
   int			first_sequence,		// First notify-sequence-number used
 			last_sequence;		// Last notify-sequence-number used
   cups_array_t		*events;		// Events (ipp_t *'s)
+  size_t		memused;		// Bytes recorded for memory accounting
   bool			is_canceled;		// Has this subscription been canceled?
 };
 
@@ -106,6 +106,7 @@ papplSubscriptionCreate(
 
   pthread_rwlock_init(&sub->rwlock, NULL);
 
+  sub->system          = system;
   sub->printer         = printer;
   sub->job             = job;
   sub->subscription_id = sub_id;
@@ -144,6 +145,8 @@ papplSubscriptionCreate(
 
   sub->events = cupsArrayNew(NULL, NULL, NULL, 0, NULL, (cups_afree_cb_t)ippDelete);
 
+  _papplSystemUpdateMemory(system, PAPPL_MEMORY_SUBSCRIPTIONS, &sub->memused, sizeof(pappl_subscription_t) + ippLength(sub->attrs));
+
   return (sub);
 }
 
@@ -163,6 +166,8 @@ _papplSubscriptionDelete(
   free(sub->language);
   cupsArrayDelete(sub->events);
 
+  _papplSystemUpdateMemory(sub->system, PAPPL_MEMORY_SUBSCRIPTIONS, &sub->memused, 0);
+
   pthread_rwlock_unlock(&sub->rwlock);
   pthread_rwlock_destroy(&sub->rwlock);
 
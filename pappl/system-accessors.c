@@ -35,6 +35,7 @@ static bool		add_listeners(pappl_system_t *system, const char *name, int port, i
 static int		compare_filters(_pappl_mime_filter_t *a, _pappl_mime_filter_t *b);
 static int		compare_timers(_pappl_timer_t *a, _pappl_timer_t *b);
 static _pappl_mime_filter_t *copy_filter(_pappl_mime_filter_t *f);
+static void		*refresh_wifi(pappl_system_t *system);
 
 
 //
@@ -793,6 +794,24 @@ papplSystemGetMaxClients(
 }
 
 
+//
+// 'papplSystemGetMaxFormSize()' - Get the maximum form data size.
+//
+// This function gets the maximum number of bytes of "multipart/form-data"
+// that are accepted from a web browser, for example when uploading files.  A
+// maximum of `0` means there is no limit.
+//
+// The default maximum form data size is 16MiB or `16777216` bytes.
+//
+
+size_t					// O - Maximum form data size in bytes or `0` for none
+papplSystemGetMaxFormSize(
+    pappl_system_t *system)		// I - System
+{
+  return (system ? system->max_form_size : 0);
+}
+
+
 //
 // 'papplSystemGetMaxLogSize()' - Get the maximum log file size.
 //
@@ -829,6 +848,41 @@ papplSystemGetMaxSubscriptions(
 }
 
 
+//
+// 'papplSystemGetMemoryUsage()' - Get the memory usage of a subsystem.
+//
+// This function returns the current and peak number of bytes allocated by the
+// specified subsystem.  The values are estimates based on the size of the
+// objects and attributes that are kept in memory and are intended for tuning
+// limits such as the maximum number of completed jobs or subscriptions.
+//
+// @since PAPPL 1.3@
+//
+
+bool					// O - `true` on success, `false` on error
+papplSystemGetMemoryUsage(
+    pappl_system_t *system,		// I - System
+    pappl_memory_t subsystem,		// I - Subsystem
+    size_t         *current,		// O - Current bytes or `NULL`
+    size_t         *peak)		// O - Peak bytes or `NULL`
+{
+  if (current)
+    *current = 0;
+  if (peak)
+    *peak = 0;
+
+  if (!system || subsystem < PAPPL_MEMORY_JOBS || subsystem > PAPPL_MEMORY_RIP)
+    return (false);
+
+  if (current)
+    *current = (size_t)_PAPPL_ATOMIC_GET64(system->mem_current + subsystem);
+  if (peak)
+    *peak = (size_t)_PAPPL_ATOMIC_GET64(system->mem_peak + subsystem);
+
+  return (true);
+}
+
+
 //
 // 'papplSystemGetName()' - Get the system name.
 //
@@ -1076,6 +1130,38 @@ papplSystemGetSessionKey(
 }
 
 
+//
+// 'papplSystemGetThreadScheduling()' - Get the scheduling parameters for a
+//                                      class of threads.
+//
+// This function copies the scheduling parameters used for the specified class
+// of threads.
+//
+// @since PAPPL 1.3@
+//
+
+bool					// O - `true` on success, `false` on error
+papplSystemGetThreadScheduling(
+    pappl_system_t       *system,	// I - System
+    pappl_thread_t       thread,	// I - Thread class
+    pappl_thread_sched_t *sched)	// O - Scheduling parameters
+{
+  if (!system || thread < PAPPL_THREAD_CLIENT || thread > PAPPL_THREAD_JOB || !sched)
+  {
+    if (sched)
+      memset(sched, 0, sizeof(pappl_thread_sched_t));
+
+    return (false);
+  }
+
+  pthread_rwlock_rdlock(&system->rwlock);
+  *sched = system->thread_sched[thread];
+  pthread_rwlock_unlock(&system->rwlock);
+
+  return (true);
+}
+
+
 //
 // 'papplSystemGetTLSOnly()' - Get the TLS-only state of the system.
 //
@@ -1139,6 +1225,59 @@ papplSystemGetVersions(
 }
 
 
+//
+// '_papplSystemGetWiFiStatus()' - Get the cached Wi-Fi status.
+//
+// The Wi-Fi status callback is never called directly.  When there is no
+// cached status, or the cached status is older than `_PAPPL_WIFI_TTL` seconds,
+// it is refreshed in the background.  Until the first refresh completes the
+// status is unknown and `false` is returned, otherwise the cached status
+// continues to be returned while it is refreshed.
+//
+
+bool					// O - `true` if the status is available, `false` otherwise
+_papplSystemGetWiFiStatus(
+    pappl_system_t *system,		// I - System
+    pappl_wifi_t   *wifi)		// O - Wi-Fi status
+{
+  bool		ret,			// Return value
+		refresh = false;	// Start a background refresh?
+  time_t	curtime = time(NULL);	// Current time
+
+
+  if (!system->wifi_status_cb)
+    return (false);
+
+  pthread_mutex_lock(&system->wifi_mutex);
+
+  if ((!system->wifi_time || (curtime - system->wifi_time) >= _PAPPL_WIFI_TTL) && !system->wifi_refresh)
+  {
+    // Cached status is missing or stale, refresh it in the background...
+    refresh = system->wifi_refresh = true;
+  }
+
+  if ((ret = system->wifi_valid) == true)
+    *wifi = system->wifi;
+
+  pthread_mutex_unlock(&system->wifi_mutex);
+
+  if (refresh)
+  {
+    if (!_papplSystemCreateThread(system, PAPPL_THREAD_JOB, NULL, (void *(*)(void *))refresh_wifi, system))
+    {
+      papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create Wi-Fi status thread: %s", strerror(errno));
+
+      pthread_mutex_lock(&system->wifi_mutex);
+      system->wifi_refresh = false;
+      pthread_cond_broadcast(&system->wifi_cond);
+      pthread_mutex_unlock(&system->wifi_mutex);
+    }
+  }
+
+  return (ret);
+}
+
+
 //
 // 'papplSystemHashPassword()' - Generate a password hash using salt and password strings.
 //
@@ -1887,6 +2026,34 @@ papplSystemSetMaxClients(
 }
 
 
+//
+// 'papplSystemSetMaxFormSize()' - Set the maximum form data size in bytes.
+//
+// This function sets the maximum number of bytes of "multipart/form-data"
+// that are accepted from a web browser, for example when uploading files.
+// Embedded files are written to temporary files as they are received, so
+// larger limits do not use more memory.  Set the maximum size to `0` to
+// disable the limit.
+//
+// The default maximum form data size is 16MiB or `16777216` bytes.
+//
+
+void
+papplSystemSetMaxFormSize(
+    pappl_system_t *system,		// I - System
+    size_t         max_size)		// I - Maximum form data size in bytes or `0` for none
+{
+  if (system)
+  {
+    pthread_rwlock_wrlock(&system->rwlock);
+
+    system->max_form_size = max_size;
+
+    pthread_rwlock_unlock(&system->rwlock);
+  }
+}
+
+
 //
 // 'papplSystemSetMaxLogSize()' - Set the maximum log file size in bytes.
 //
@@ -2193,6 +2360,59 @@ papplSystemSetSaveCallback(
 }
 
 
+//
+// 'papplSystemSetThreadScheduling()' - Set the scheduling parameters for a
+//                                      class of threads.
+//
+// This function sets the scheduling parameters used when creating client
+// connection (`PAPPL_THREAD_CLIENT`), device I/O (`PAPPL_THREAD_DEVICE`), or
+// job processing and background task (`PAPPL_THREAD_JOB`) threads.  For
+// example, to keep a system responsive while rendering large jobs, lower the
+// priority of job threads and restrict them to CPU 1:
+//
+// ```
+// |pappl_thread_sched_t sched;
+// |
+// |memset(&sched, 0, sizeof(sched));
+// |sched.nice        = 10;
+// |sched.affinity[0] = 0x02;
+// |
+// |papplSystemSetThreadScheduling(system, PAPPL_THREAD_JOB, &sched);
+// ```
+//
+// The "policy" and "priority" members specify a POSIX scheduling policy and
+// priority, which usually require additional privileges - if the policy cannot
+// be used the thread is created with the default policy.  The "nice" and
+// "affinity" members are only supported on Linux, with up to `PAPPL_MAX_CPU`
+// CPUs in the affinity bitmask.  Pass `NULL` for the "sched" argument to
+// restore the default scheduling parameters.
+//
+// > Note: The scheduling parameters can only be set prior to calling
+// > @link papplSystemRun@.
+//
+// @since PAPPL 1.3@
+//
+
+void
+papplSystemSetThreadScheduling(
+    pappl_system_t             *system,	// I - System
+    pappl_thread_t             thread,	// I - Thread class
+    const pappl_thread_sched_t *sched)	// I - Scheduling parameters or `NULL` for default
+{
+  if (system && !system->is_running && thread >= PAPPL_THREAD_CLIENT && thread <= PAPPL_THREAD_JOB)
+  {
+    pthread_rwlock_wrlock(&system->rwlock);
+
+    if (sched)
+      system->thread_sched[thread] = *sched;
+    else
+      memset(system->thread_sched + thread, 0, sizeof(pappl_thread_sched_t));
+
+    pthread_rwlock_unlock(&system->rwlock);
+  }
+}
+
+
 //
 // 'papplSystemSetUUID()' - Set the system UUID.
 //
@@ -2298,6 +2518,83 @@ papplSystemSetWiFiCallbacks(
 }
 
 
+//
+// 'papplSystemSetWiFiStatus()' - Update the cached Wi-Fi status.
+//
+// This function lets the Printer Application push the current Wi-Fi status
+// when it changes, for example from a network manager notification.  The
+// status is otherwise queried with the Wi-Fi status callback and cached for
+// up to `_PAPPL_WIFI_TTL` seconds.  Pass `NULL` for the "wifi" argument to
+// discard the cached status so that it is queried again on the next use.
+//
+
+void
+papplSystemSetWiFiStatus(
+    pappl_system_t     *system,		// I - System
+    const pappl_wifi_t *wifi)		// I - Wi-Fi status or `NULL` to query again
+{
+  bool	changed = false;		// Did the status change?
+
+
+  if (!system)
+    return;
+
+  pthread_mutex_lock(&system->wifi_mutex);
+
+  if (wifi)
+  {
+    changed = !system->wifi_valid || system->wifi.state != wifi->state || strcmp(system->wifi.ssid, wifi->ssid);
+
+    system->wifi       = *wifi;
+    system->wifi_valid = true;
+    system->wifi_time  = time(NULL);
+  }
+  else
+  {
+    system->wifi_time = 0;
+  }
+
+  pthread_mutex_unlock(&system->wifi_mutex);
+
+  if (changed)
+    papplSystemAddEvent(system, NULL, NULL, PAPPL_EVENT_SYSTEM_STATE_CHANGED, "Wi-Fi status changed.");
+}
+
+
+//
+// '_papplSystemUpdateMemory()' - Update the memory used by an object.
+//
+// The "used" argument points to the number of bytes previously recorded for
+// the object, which is replaced by "newused".  Pass `0` for "newused" when the
+// object is freed.
+//
+
+void
+_papplSystemUpdateMemory(
+    pappl_system_t *system,		// I  - System
+    pappl_memory_t subsystem,		// I  - Subsystem
+    size_t         *used,		// IO - Bytes recorded for object
+    size_t         newused)		// I  - New bytes used by object
+{
+  long long	delta,			// Change in bytes
+		current;		// Current bytes for subsystem
+
+
+  if (!system || !used || *used == newused)
+    return;
+
+  // Adjust the current count using 64-bit counters on all platforms...
+  delta   = (long long)newused - (long long)*used;
+  current = _PAPPL_ATOMIC_ADD64(system->mem_current + subsystem, delta) + delta;
+  *used   = newused;
+
+  // Update the peak count - this may miss a concurrent peak but is good enough
+  // for reporting...
+  if (current > _PAPPL_ATOMIC_GET64(system->mem_peak + subsystem))
+    _PAPPL_ATOMIC_SET64(system->mem_peak + subsystem, current);
+}
+
+
 //
 // 'add_listeners()' - Create and add listener sockets to a system.
 //
@@ -2418,3 +2715,42 @@ copy_filter(_pappl_mime_filter_t *f)	// I - Filter definition
 
   return (newf);
 }
+
+
+//
+// 'refresh_wifi()' - Refresh the cached Wi-Fi status.
+//
+
+static void *				// O - Thread exit status
+refresh_wifi(pappl_system_t *system)	// I - System
+{
+  pappl_wifi_t	wifi;			// Wi-Fi status
+  bool		valid,			// Is the status valid?
+		changed;		// Did the status change?
+
+
+  valid = (system->wifi_status_cb)(system, system->wifi_cbdata, &wifi) != NULL;
+
+  pthread_mutex_lock(&system->wifi_mutex);
+
+  changed = valid != system->wifi_valid || (valid && (system->wifi.state != wifi.state || strcmp(system->wifi.ssid, wifi.ssid)));
+
+  if (valid)
+    system->wifi = wifi;
+
+  system->wifi_valid = valid;
+  system->wifi_time  = time(NULL);
+
+  pthread_mutex_unlock(&system->wifi_mutex);
+
+  if (changed)
+    papplSystemAddEvent(system, NULL, NULL, PAPPL_EVENT_SYSTEM_STATE_CHANGED, "Wi-Fi status changed.");
+
+  // Clear the refresh flag last since papplSystemDelete waits for it...
+  pthread_mutex_lock(&system->wifi_mutex);
+  system->wifi_refresh = false;
+  pthread_cond_broadcast(&system->wifi_cond);
+  pthread_mutex_unlock(&system->wifi_mutex);
+
+  return (NULL);
+}
@@ -167,7 +167,7 @@ ipp_create_printer(
   }
 
   // Get required attributes...
-  if ((attr = ippFindAttribute(client->request, "printer-service-type", IPP_TAG_ZERO)) == NULL)
+  if ((attr = _papplClientFindAttribute(client, "printer-service-type", IPP_TAG_ZERO)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing 'printer-service-type' attribute in request.");
     return;
@@ -178,7 +178,7 @@ ipp_create_printer(
     return;
   }
 
-  if ((attr = ippFindAttribute(client->request, "printer-name", IPP_TAG_ZERO)) == NULL)
+  if ((attr = _papplClientFindAttribute(client, "printer-name", IPP_TAG_ZERO)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing 'printer-name' attribute in request.");
     return;
@@ -191,7 +191,7 @@ ipp_create_printer(
   else
     printer_name = ippGetString(attr, 0, NULL);
 
-  if ((attr = ippFindAttribute(client->request, "printer-device-id", IPP_TAG_ZERO)) != NULL && (ippGetGroupTag(attr) != IPP_TAG_PRINTER || ippGetValueTag(attr) != IPP_TAG_TEXT || ippGetCount(attr) != 1))
+  if ((attr = _papplClientFindAttribute(client, "printer-device-id", IPP_TAG_ZERO)) != NULL && (ippGetGroupTag(attr) != IPP_TAG_PRINTER || ippGetValueTag(attr) != IPP_TAG_TEXT || ippGetCount(attr) != 1))
   {
     papplClientRespondIPPUnsupported(client, attr);
     return;
@@ -199,7 +199,7 @@ ipp_create_printer(
   else
     device_id = ippGetString(attr, 0, NULL);
 
-  if ((attr = ippFindAttribute(client->request, "smi2699-device-uri", IPP_TAG_ZERO)) == NULL)
+  if ((attr = _papplClientFindAttribute(client, "smi2699-device-uri", IPP_TAG_ZERO)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing 'smi2699-device-uri' attribute in request.");
     return;
@@ -220,7 +220,7 @@ ipp_create_printer(
     }
   }
 
-  if ((attr = ippFindAttribute(client->request, "smi2699-device-command", IPP_TAG_ZERO)) == NULL)
+  if ((attr = _papplClientFindAttribute(client, "smi2699-device-command", IPP_TAG_ZERO)) == NULL)
   {
     papplClientRespondIPP(client, IPP_STATUS_ERROR_BAD_REQUEST, "Missing 'smi2699-device-command' attribute in request.");
     return;
@@ -282,7 +282,12 @@ ipp_create_printer(
   cupsArrayAdd(ra, "printer-uuid");
   cupsArrayAdd(ra, "printer-xri-supported");
 
+  pthread_rwlock_rdlock(&printer->jobs_rwlock);
+  pthread_rwlock_rdlock(&printer->rwlock);
   _papplPrinterCopyAttributes(printer, client, ra, NULL);
+  pthread_rwlock_unlock(&printer->rwlock);
+  pthread_rwlock_unlock(&printer->jobs_rwlock);
+
   cupsArrayDelete(ra);
 }
 
@@ -401,9 +406,9 @@ ipp_get_printers(
 
 
   // Get request attributes...
-  limit  = (cups_len_t)ippGetInteger(ippFindAttribute(client->request, "limit", IPP_TAG_INTEGER), 0);
+  limit  = (cups_len_t)ippGetInteger(_papplClientFindAttribute(client, "limit", IPP_TAG_INTEGER), 0);
   ra     = ippCreateRequestedArray(client->request);
-  format = ippGetString(ippFindAttribute(client->request, "document-format", IPP_TAG_MIMETYPE), 0, NULL);
+  format = ippGetString(_papplClientFindAttribute(client, "document-format", IPP_TAG_MIMETYPE), 0, NULL);
 
   papplClientRespondIPP(client, IPP_STATUS_OK, NULL);
 
@@ -425,9 +430,11 @@ ipp_get_printers(
     if (i)
       ippAddSeparator(client->response);
 
+    pthread_rwlock_rdlock(&printer->jobs_rwlock);
     pthread_rwlock_rdlock(&printer->rwlock);
     _papplPrinterCopyAttributes(printer, client, ra, format);
     pthread_rwlock_unlock(&printer->rwlock);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
   }
 
   pthread_rwlock_unlock(&system->rwlock);
@@ -175,6 +175,10 @@ papplSystemLoadState(
 	  papplPrinterSetMaxActiveJobs(printer, (int)strtol(value, NULL, 10));
 	else if (!strcasecmp(line, "MaxCompletedJobs") && value)
 	  papplPrinterSetMaxCompletedJobs(printer, (int)strtol(value, NULL, 10));
+	else if (!strcasecmp(line, "MaxPreservedJobs") && value)
+	  papplPrinterSetMaxPreservedJobs(printer, (int)strtol(value, NULL, 10));
+	else if (!strcasecmp(line, "MaxPreservedBytes") && value)
+	  papplPrinterSetMaxPreservedBytes(printer, (size_t)strtoll(value, NULL, 10));
 	else if (!strcasecmp(line, "NextJobId") && value)
 	  papplPrinterSetNextJobID(printer, (int)strtol(value, NULL, 10));
 	else if (!strcasecmp(line, "ImpressionsCompleted") && value)
@@ -264,6 +268,8 @@ papplSystemLoadState(
           {
             ippAddString(printer->driver_attrs, IPP_TAG_PRINTER, IPP_TAG_TEXT, defname, NULL, value);
           }
+
+          printer->driver_version ++;
         }
 	else if (!strcasecmp(line, "Job") && value)
 	{
@@ -332,6 +338,8 @@ papplSystemLoadState(
 	    ippReadFile(attr_fd, job->attrs);
 	    close(attr_fd);
 
+	    _papplJobUpdateMemory(job);
+
 	    if (!job->filename || stat(job->filename, &jobbuf))
 	    {
 	      // If file removed, then set job state to aborted...
@@ -353,6 +361,14 @@ papplSystemLoadState(
 	  papplLog(system, PAPPL_LOGLEVEL_WARN, "Unknown printer directive '%s' on line %d of '%s'.", line, linenum, filename);
       }
 
+      if (printer)
+      {
+        // Update the media cache for the loaded defaults and ready media...
+        pthread_rwlock_wrlock(&printer->rwlock);
+        _papplPrinterUpdateMediaNoLock(printer);
+        pthread_rwlock_unlock(&printer->rwlock);
+      }
+
       // Loaded all printer attributes, call the status callback (if any) to
       // update the current printer state...
       if (printer && printer->driver_data.status_cb)
@@ -442,6 +458,7 @@ papplSystemSaveState(
     if (printer->is_deleted)
       continue;
 
+    pthread_rwlock_rdlock(&printer->jobs_rwlock);
     pthread_rwlock_rdlock(&printer->rwlock);
 
     num_options = cupsAddIntegerOption("id", printer->printer_id, num_options, &options);
@@ -468,7 +485,9 @@ papplSystemSaveState(
       cupsFilePutConf(fp, "PrintGroup", printer->print_group);
     cupsFilePrintf(fp, "MaxActiveJobs %d\n", printer->max_active_jobs);
     cupsFilePrintf(fp, "MaxCompletedJobs %d\n", printer->max_completed_jobs);
-    cupsFilePrintf(fp, "NextJobId %d\n", printer->next_job_id);
+    cupsFilePrintf(fp, "MaxPreservedJobs %d\n", printer->max_preserved_jobs);
+    cupsFilePrintf(fp, "MaxPreservedBytes %lld\n", (long long)printer->max_preserved_bytes);
+    cupsFilePrintf(fp, "NextJobId %d\n", _PAPPL_ATOMIC_GET(&printer->next_job_id));
     cupsFilePrintf(fp, "ImpressionsCompleted %d\n", printer->impcompleted);
 
     if (printer->driver_data.identify_default)
@@ -593,6 +612,7 @@ papplSystemSaveState(
     cupsFilePuts(fp, "</Printer>\n");
 
     pthread_rwlock_unlock(&printer->rwlock);
+    pthread_rwlock_unlock(&printer->jobs_rwlock);
   }
 
   pthread_rwlock_unlock(&system->rwlock);
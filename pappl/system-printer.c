@@ -121,6 +121,45 @@ papplSystemFindPrinter(
 }
 
 
+//
+// 'papplSystemRetryDevices()' - Retry opening devices that are unavailable.
+//
+// This function tells any printers waiting for their device to become
+// available to retry immediately instead of waiting for the next scheduled
+// attempt.  It is normally called when the application sees a USB hotplug,
+// DNS-SD, or network change event.
+//
+// The "device_uri" argument specifies the device that changed.  Specify
+// `NULL` to retry the devices for all printers.
+//
+
+void
+papplSystemRetryDevices(
+    pappl_system_t *system,		// I - System
+    const char     *device_uri)		// I - Device URI or `NULL` for all
+{
+  cups_len_t		i,		// Current printer index
+			count;		// Printer count
+  pappl_printer_t	*printer;	// Current printer
+
+
+  if (!system)
+    return;
+
+  pthread_rwlock_rdlock(&system->rwlock);
+
+  for (i = 0, count = cupsArrayGetCount(system->printers); i < count; i ++)
+  {
+    printer = (pappl_printer_t *)cupsArrayGetElement(system->printers, i);
+
+    if (!device_uri || !strcmp(printer->device_uri, device_uri))
+      _papplPrinterWakeDevice(printer);
+  }
+
+  pthread_rwlock_unlock(&system->rwlock);
+}
+
+
 //
 // 'compare_printers()' - Compare two printers.
 //
@@ -20,6 +20,11 @@
 //
 
 #  define _PAPPL_MAX_LISTENERS	32	// Maximum number of listener sockets
+#  define _PAPPL_MAX_MEMORY	(PAPPL_MEMORY_RIP + 1)
+					// Number of memory accounting subsystems
+#  define _PAPPL_MAX_THREAD	(PAPPL_THREAD_JOB + 1)
+					// Number of thread classes
+#  define _PAPPL_WIFI_TTL	30	// Maximum age of cached Wi-Fi status in seconds
 
 
 //
@@ -43,15 +48,28 @@ typedef struct _pappl_resource_s	// Resource
   time_t		last_modified;		// Last-Modified date/time
   const void		*data;			// Static data
   size_t		length;			// Length of file/data
+  char			etag[36];		// Strong entity tag for static data
+  size_t		memused;		// Bytes recorded for memory accounting
   pappl_resource_cb_t	cb;			// Dynamic callback
   void			*cbdata;		// Callback data
 } _pappl_resource_t;
 
+typedef enum _pappl_tlsgen_e		// TLS credential generation states
+{
+  _PAPPL_TLSGEN_IDLE,				// No credentials being generated
+  _PAPPL_TLSGEN_RUNNING,			// Generating credentials
+  _PAPPL_TLSGEN_SUCCESS,			// Credentials generated
+  _PAPPL_TLSGEN_ERROR				// Unable to generate credentials
+} _pappl_tlsgen_t;
+
 struct _pappl_system_s			// System data
 {
   pthread_rwlock_t	rwlock;			// Reader/writer lock
   pappl_soptions_t	options;		// Server options
   bool			is_running;		// Is the system running?
+  pthread_mutex_t	running_mutex;		// Mutex for startup/shutdown notifications
+  pthread_cond_t	running_cond;		// Startup/shutdown condition
+  bool			is_started;		// Has the system finished starting up?
   time_t		start_time,		// Startup time
 			config_time,		// Time of last config change
 			clean_time,		// Next clean time
@@ -134,12 +152,31 @@ struct _pappl_system_s			// System data
   pappl_wifi_list_cb_t	wifi_list_cb;		// Wi-Fi list callback
   pappl_wifi_status_cb_t wifi_status_cb;	// Wi-Fi status callback
   void			*wifi_cbdata;		// Wi-Fi callback data
+  pthread_mutex_t	wifi_mutex;		// Mutex for cached Wi-Fi status
+  pthread_cond_t	wifi_cond;		// Wi-Fi status refresh condition
+  pappl_wifi_t		wifi;			// Cached Wi-Fi status
+  bool			wifi_valid,		// Is the cached Wi-Fi status valid?
+			wifi_refresh;		// Is a Wi-Fi status refresh running?
+  time_t		wifi_time;		// Time of cached Wi-Fi status, `0` if none
+  pthread_mutex_t	tls_mutex;		// Mutex for TLS credential generation
+  pthread_cond_t	tls_cond;		// TLS credential generation condition
+  _pappl_tlsgen_t	tls_state;		// TLS credential generation state
+  bool			tls_csr;		// Generating a certificate signing request?
+  int			tls_progress;		// TLS credential generation progress (0-100)
+  char			tls_crqpath[256];	// Certificate signing request path, if any
+  long long		mem_current[_PAPPL_MAX_MEMORY],
+						// Current bytes per subsystem (atomic, 64-bit)
+			mem_peak[_PAPPL_MAX_MEMORY];
+						// Peak bytes per subsystem (atomic, 64-bit)
+  pappl_thread_sched_t	thread_sched[_PAPPL_MAX_THREAD];
+						// Scheduling parameters per thread class
 
   pappl_event_cb_t	event_cb;		// Event callback
   void			*event_data;		// Event callback data
   pappl_event_cb_t	systemui_cb;		// System UI event callback
   void			*systemui_data;		// System UI event callback data
   size_t		max_subscriptions;	// Maximum number of subscriptions
+  size_t		max_form_size;		// Maximum form data size in bytes or `0` for none
   cups_array_t		*subscriptions;		// Subscription array
   int			next_subscription_id;	// Next "notify-subscription-id" value
   pthread_cond_t	subscription_cond;	// Subscription condition variable
@@ -169,15 +206,18 @@ extern bool		_papplSystemAddSubscription(pappl_system_t *system, pappl_subscript
 extern void		_papplSystemCleanJobs(pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemCleanSubscriptions(pappl_system_t *system, bool clean_all) _PAPPL_PRIVATE;
 extern void		_papplSystemConfigChanged(pappl_system_t *system) _PAPPL_PRIVATE;
+extern bool		_papplSystemCreateThread(pappl_system_t *system, pappl_thread_t thread, pthread_t *tid, void *(*func)(void *), void *data) _PAPPL_PRIVATE;
 extern void		_papplSystemExportVersions(pappl_system_t *system, ipp_t *ipp, ipp_tag_t group_tag, cups_array_t *ra);
 extern _pappl_mime_filter_t *_papplSystemFindMIMEFilter(pappl_system_t *system, const char *srctype, const char *dsttype) _PAPPL_PRIVATE;
 extern _pappl_resource_t *_papplSystemFindResourceForLanguage(pappl_system_t *system, const char *language) _PAPPL_PRIVATE;
 extern _pappl_resource_t *_papplSystemFindResourceForPath(pappl_system_t *system, const char *path) _PAPPL_PRIVATE;
+extern bool		_papplSystemGetWiFiStatus(pappl_system_t *system, pappl_wifi_t *wifi) _PAPPL_PRIVATE;
 extern char		*_papplSystemMakeUUID(pappl_system_t *system, const char *printer_name, int job_id, char *buffer, size_t bufsize) _PAPPL_PRIVATE;
 extern void		_papplSystemProcessIPP(pappl_client_t *client) _PAPPL_PRIVATE;
 extern bool		_papplSystemRegisterDNSSDNoLock(pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemStatusUI(pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemUnregisterDNSSDNoLock(pappl_system_t *system) _PAPPL_PRIVATE;
+extern void		_papplSystemUpdateMemory(pappl_system_t *system, pappl_memory_t subsystem, size_t *used, size_t newused) _PAPPL_PRIVATE;
 
 extern void		_papplSystemWebAddPrinter(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemWebConfig(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
@@ -185,6 +225,7 @@ extern void		_papplSystemWebConfigFinalize(pappl_system_t *system, cups_len_t nu
 extern void		_papplSystemWebHome(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemWebLogFile(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemWebLogs(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
+extern void		_papplSystemWebMemory(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemWebNetwork(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemWebSecurity(pappl_client_t *client, pappl_system_t *system) _PAPPL_PRIVATE;
 extern void		_papplSystemWebSettings(pappl_client_t *client) _PAPPL_PRIVATE;
@@ -98,6 +98,10 @@ _papplSystemAddEventNoLockv(
   va_list		cap;		// Copy of additional arguments
 
 
+  // Count the state change so cached printer state can be invalidated...
+  if (printer)
+    _PAPPL_ATOMIC_ADD(&printer->event_count, 1);
+
   // Loop through all of the subscriptions and deliver any events...
   pthread_rwlock_rdlock(&system->rwlock);
 
@@ -165,9 +169,15 @@ _papplSystemAddEventNoLockv(
 	ippAddInteger(n, IPP_TAG_EVENT_NOTIFICATION, IPP_TAG_INTEGER, "system-up-time", (int)(time(NULL) - system->start_time));
 
       cupsArrayAdd(sub->events, n);
+      _papplSystemUpdateMemory(system, PAPPL_MEMORY_SUBSCRIPTIONS, &sub->memused, sub->memused + ippLength(n));
+
       if (cupsArrayGetCount(sub->events) > PAPPL_MAX_EVENTS)
       {
-	cupsArrayRemove(sub->events, cupsArrayGetFirst(sub->events));
+        ipp_t *first = (ipp_t *)cupsArrayGetFirst(sub->events);
+					// Oldest event
+
+	_papplSystemUpdateMemory(system, PAPPL_MEMORY_SUBSCRIPTIONS, &sub->memused, sub->memused - ippLength(first));
+	cupsArrayRemove(sub->events, first);
 	sub->first_sequence ++;
       }
 
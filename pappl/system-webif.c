@@ -39,20 +39,47 @@ typedef struct _pappl_system_dev_s	// System device callback data
   const char		*device_uri;	// Current device URI
 } _pappl_system_dev_t;
 
+typedef struct _pappl_system_printer_s	// Printer list entry for the home page
+{
+  pappl_printer_t	*printer;	// Printer
+  ipp_pstate_t		state;		// "printer-state" value
+  char			name[128],	// "printer-name" value
+			location[128];	// "printer-location" value
+} _pappl_system_printer_t;
+
+#if defined(HAVE_OPENSSL) || defined(HAVE_GNUTLS)
+typedef struct _pappl_tls_request_s	// TLS credential generation request
+{
+  pappl_system_t	*system;	// System
+  bool			csr;		// Create a certificate signing request?
+  cups_len_t		num_form;	// Number of form variables
+  cups_option_t		*form;		// Form variables
+} _pappl_tls_request_t;
+#endif // HAVE_OPENSSL || HAVE_GNUTLS
+
 
 //
 // Local functions...
 //
 
+static int	compare_printer_locations(_pappl_system_printer_t *a, _pappl_system_printer_t *b);
+static int	compare_printer_names(_pappl_system_printer_t *a, _pappl_system_printer_t *b);
+static int	compare_printer_states(_pappl_system_printer_t *a, _pappl_system_printer_t *b);
+static bool	match_printer(pappl_printer_t *printer, const char *filter);
+static void	printer_pager(pappl_client_t *client, size_t num_printers, int printer_index, int limit, const char *query);
 static bool	system_device_cb(const char *device_info, const char *device_uri, const char *device_id, void *data);
 static void	system_footer(pappl_client_t *client);
-static void	system_header(pappl_client_t *client, const char *title);
+static void	system_header(pappl_client_t *client, const char *title, int refresh);
 
 #if defined(HAVE_OPENSSL) || defined(HAVE_GNUTLS)
 static bool	tls_install_certificate(pappl_client_t *client, const char *crtfile, const char *keyfile);
 static bool	tls_install_file(pappl_client_t *client, const char *dst, const char *src);
-static bool	tls_make_certificate(pappl_client_t *client, cups_len_t num_form, cups_option_t *form);
-static bool	tls_make_certsignreq(pappl_client_t *client, cups_len_t num_form, cups_option_t *form, char *crqpath, size_t crqsize);
+static bool	tls_make_certificate(pappl_system_t *system, cups_len_t num_form, cups_option_t *form);
+static bool	tls_make_certsignreq(pappl_system_t *system, cups_len_t num_form, cups_option_t *form, char *crqpath, size_t crqsize);
+static void	*tls_make_credentials(_pappl_tls_request_t *req);
+static void	tls_set_progress(pappl_system_t *system, int progress);
+static bool	tls_start_credentials(pappl_system_t *system, bool csr, cups_len_t num_form, cups_option_t *form);
+static void	tls_use_credentials(pappl_system_t *system);
 #endif // HAVE_OPENSSL || HAVE_GNUTLS
 
 
@@ -473,7 +500,7 @@ _papplSystemWebAddPrinter(
     cupsFreeOptions(num_form, form);
   }
 
-  system_header(client, _PAPPL_LOC("Add Printer"));
+  system_header(client, _PAPPL_LOC("Add Printer"), 0);
 
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
@@ -565,7 +592,7 @@ _papplSystemWebConfig(
     cupsFreeOptions(num_form, form);
   }
 
-  system_header(client, _PAPPL_LOC("Configuration"));
+  system_header(client, _PAPPL_LOC("Configuration"), 0);
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
 
@@ -648,13 +675,60 @@ _papplSystemWebConfigFinalize(
 //
 // '_papplSystemWebHome()' - Show the system home page.
 //
+// The printer list is filtered, sorted, and paged using the "filter", "sort",
+// and "printer-index" form variables so that only one page of printers is
+// rendered per request.  The printers array is already sorted by name, so the
+// default sort order walks the array from the page offset and only the state
+// and location sort orders collect and sort the printers.
+//
 
 void
 _papplSystemWebHome(
     pappl_client_t *client,		// I - Client
     pappl_system_t *system)		// I - System
 {
-  system_header(client, NULL);
+  cups_len_t		num_form = 0;	// Number of form variables
+  cups_option_t		*form = NULL;	// Form variables
+  const char		*value,		// Form variable value
+			*filter = NULL,	// Printer filter, if any
+			*sort = "name";	// Sort order
+  int			printer_index = 1;
+					// First printer shown (1-based)
+  const int		limit = 20;	// Printers per page
+  _pappl_system_printer_t *printers = NULL;
+					// Matching printers
+  size_t		i,		// Looping var
+			count,		// Number of printers
+			num_printers = 0,
+					// Number of matching printers
+			first,		// First matching printer shown (0-based)
+			last;		// Last matching printer shown + 1
+  pappl_printer_t	*printer;	// Current printer
+  char			query[1024],	// Query string for pager links
+			*qptr;		// Pointer into query string
+  static const char * const sorts[][2] =
+  {					// Sort orders
+    { "name",     _PAPPL_LOC("Name") },
+    { "state",    _PAPPL_LOC("Status") },
+    { "location", _PAPPL_LOC("Location") }
+  };
+
+
+  if (client->operation == HTTP_STATE_GET)
+  {
+    num_form = (cups_len_t)papplClientGetForm(client, &form);
+
+    if ((value = cupsGetOption("printer-index", num_form, form)) != NULL)
+      printer_index = (int)strtol(value, NULL, 10);
+
+    if ((value = cupsGetOption("filter", num_form, form)) != NULL && *value)
+      filter = value;
+
+    if ((value = cupsGetOption("sort", num_form, form)) != NULL && (!strcmp(value, "state") || !strcmp(value, "location")))
+      sort = value;
+  }
+
+  system_header(client, NULL, 0);
 
   papplClientHTMLPrintf(client,
 			"      <div class=\"row\">\n"
@@ -674,7 +748,142 @@ _papplSystemWebHome(
 
   _papplClientHTMLPutLinks(client, system->links, PAPPL_LOPTIONS_PRINTER);
 
-  papplSystemIteratePrinters(system, (pappl_printer_cb_t)_papplPrinterWebIteratorCallback, client);
+  // Count or collect, filter, and sort the printers...
+  //
+  // Note: Cannot use cupsArrayGetFirst/Last since other threads might be
+  // enumerating the printers array.
+  pthread_rwlock_rdlock(&system->rwlock);
+
+  count = (size_t)cupsArrayGetCount(system->printers);
+
+  if (!strcmp(sort, "name"))
+  {
+    // The printers array is sorted by name, just count the matches...
+    if (filter)
+    {
+      for (i = 0; i < count; i ++)
+      {
+        printer = (pappl_printer_t *)cupsArrayGetElement(system->printers, (cups_len_t)i);
+
+        pthread_rwlock_rdlock(&printer->rwlock);
+        if (match_printer(printer, filter))
+          num_printers ++;
+        pthread_rwlock_unlock(&printer->rwlock);
+      }
+    }
+    else
+    {
+      num_printers = count;
+    }
+  }
+  else if (count > 0 && (printers = calloc(count, sizeof(_pappl_system_printer_t))) != NULL)
+  {
+    for (i = 0; i < count; i ++)
+    {
+      printer = (pappl_printer_t *)cupsArrayGetElement(system->printers, (cups_len_t)i);
+
+      pthread_rwlock_rdlock(&printer->rwlock);
+
+      if (!filter || match_printer(printer, filter))
+      {
+        printers[num_printers].printer = printer;
+        printers[num_printers].state   = printer->state;
+        papplCopyString(printers[num_printers].name, printer->name, sizeof(printers[num_printers].name));
+        papplCopyString(printers[num_printers].location, printer->location ? printer->location : "", sizeof(printers[num_printers].location));
+        num_printers ++;
+      }
+
+      pthread_rwlock_unlock(&printer->rwlock);
+    }
+
+    if (!strcmp(sort, "state"))
+      qsort(printers, num_printers, sizeof(_pappl_system_printer_t), (int (*)(const void *, const void *))compare_printer_states);
+    else
+      qsort(printers, num_printers, sizeof(_pappl_system_printer_t), (int (*)(const void *, const void *))compare_printer_locations);
+  }
+
+  if (printer_index < 1 || (size_t)printer_index > num_printers)
+    printer_index = 1;
+
+  if (count > (size_t)limit || filter)
+  {
+    // Show the filter and sort controls...
+    papplClientHTMLPrintf(client,
+			  "          <form action=\"/\" method=\"GET\"><input type=\"search\" name=\"filter\" value=\"%s\" placeholder=\"%s\"> <select name=\"sort\">", filter ? filter : "", papplClientGetLocString(client, _PAPPL_LOC("Filter")));
+
+    for (i = 0; i < (sizeof(sorts) / sizeof(sorts[0])); i ++)
+      papplClientHTMLPrintf(client, "<option value=\"%s\"%s>%s</option>", sorts[i][0], !strcmp(sort, sorts[i][0]) ? " selected" : "", papplClientGetLocString(client, sorts[i][1]));
+
+    papplClientHTMLPrintf(client, "</select> <input type=\"submit\" value=\"%s\"></form>\n", papplClientGetLocString(client, _PAPPL_LOC("Show")));
+  }
+
+  // Build the query string for the pager links...
+  snprintf(query, sizeof(query), "&sort=%s", sort);
+  if (filter)
+  {
+    papplCopyString(query + strlen(query), "&filter=", sizeof(query) - strlen(query));
+
+    for (qptr = query + strlen(query), value = filter; *value && qptr < (query + sizeof(query) - 4); value ++)
+    {
+      if (isalnum(*value & 255) || strchr("-._~", *value))
+        *qptr++ = *value;
+      else if (*value == ' ')
+        *qptr++ = '+';
+      else
+      {
+        snprintf(qptr, sizeof(query) - (size_t)(qptr - query), "%%%02X", *value & 255);
+        qptr += 3;
+      }
+    }
+
+    *qptr = '\0';
+  }
+
+  printer_pager(client, num_printers, printer_index, limit, query);
+
+  first = (size_t)printer_index - 1;
+  last  = first + (size_t)limit;
+
+  if (printers)
+  {
+    // Show the page of sorted printers...
+    for (i = first; i < num_printers && i < last; i ++)
+      _papplPrinterWebIteratorCallback(printers[i].printer, client);
+  }
+  else if (!filter)
+  {
+    // Show the page of printers straight from the printers array...
+    for (i = first; i < count && i < last; i ++)
+      _papplPrinterWebIteratorCallback((pappl_printer_t *)cupsArrayGetElement(system->printers, (cups_len_t)i), client);
+  }
+  else
+  {
+    // Show the page of matching printers from the printers array...
+    size_t	match = 0;		// Current matching printer (0-based)
+    bool	matched;		// Does the printer match?
+
+    for (i = 0; i < count && match < last; i ++)
+    {
+      printer = (pappl_printer_t *)cupsArrayGetElement(system->printers, (cups_len_t)i);
+
+      pthread_rwlock_rdlock(&printer->rwlock);
+      matched = match_printer(printer, filter);
+      pthread_rwlock_unlock(&printer->rwlock);
+
+      if (matched && match ++ >= first)
+        _papplPrinterWebIteratorCallback(printer, client);
+    }
+  }
+
+  printer_pager(client, num_printers, printer_index, limit, query);
+
+  pthread_rwlock_unlock(&system->rwlock);
+
+  if (filter && num_printers == 0)
+    papplClientHTMLPrintf(client, "          <p>%s</p>\n", papplClientGetLocString(client, _PAPPL_LOC("No matching printers.")));
+
+  free(printers);
+  cupsFreeOptions(num_form, form);
 
   papplClientHTMLPuts(client,
                       "        </div>\n"
@@ -861,7 +1070,7 @@ _papplSystemWebLogs(
     cupsFreeOptions(num_form, form);
   }
 
-  system_header(client, _PAPPL_LOC("Logs"));
+  system_header(client, _PAPPL_LOC("Logs"), 0);
 
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
@@ -914,6 +1123,63 @@ _papplSystemWebLogs(
 }
 
 
+//
+// '_papplSystemWebMemory()' - Show the system memory usage.
+//
+
+void
+_papplSystemWebMemory(
+    pappl_client_t *client,		// I - Client
+    pappl_system_t *system)		// I - System
+{
+  pappl_memory_t	i;		// Looping var
+  size_t		current,	// Current bytes
+			peak,		// Peak bytes
+			total_current = 0,
+					// Total current bytes
+			total_peak = 0;	// Total peak bytes
+  static const char * const subsystems[] =
+  {					// Subsystem strings
+    _PAPPL_LOC("Jobs"),
+    _PAPPL_LOC("Printer Attributes"),
+    _PAPPL_LOC("Subscriptions and Events"),
+    _PAPPL_LOC("Resources"),
+    _PAPPL_LOC("Clients"),
+    _PAPPL_LOC("Raster Buffers")
+  };
+
+
+  if (!papplClientHTMLAuthorize(client))
+    return;
+
+  system_header(client, _PAPPL_LOC("Memory Usage"), 0);
+
+  papplClientHTMLPrintf(client,
+		        "          <table class=\"list\">\n"
+		        "            <thead>\n"
+		        "              <tr><th>%s</th><th>%s</th><th>%s</th></tr>\n"
+		        "            </thead>\n"
+		        "            <tbody>\n", papplClientGetLocString(client, _PAPPL_LOC("Subsystem")), papplClientGetLocString(client, _PAPPL_LOC("Current")), papplClientGetLocString(client, _PAPPL_LOC("Peak")));
+
+  for (i = PAPPL_MEMORY_JOBS; i <= PAPPL_MEMORY_RIP; i ++)
+  {
+    papplSystemGetMemoryUsage(system, i, &current, &peak);
+
+    total_current += current;
+    total_peak    += peak;
+
+    papplClientHTMLPrintf(client, "              <tr><td>%s</td><td>%.1fk</td><td>%.1fk</td></tr>\n", papplClientGetLocString(client, subsystems[i]), current / 1024.0, peak / 1024.0);
+  }
+
+  papplClientHTMLPrintf(client,
+		        "              <tr><th>%s</th><th>%.1fk</th><th>%.1fk</th></tr>\n"
+		        "            </tbody>\n"
+		        "          </table>\n", papplClientGetLocString(client, _PAPPL_LOC("Total")), total_current / 1024.0, total_peak / 1024.0);
+
+  system_footer(client);
+}
+
+
 //
 // '_papplSystemWebNetwork()' - Show the system network configuration page.
 //
@@ -962,7 +1228,7 @@ _papplSystemWebNetwork(
     cupsFreeOptions(num_form, form);
   }
 
-  system_header(client, _PAPPL_LOC("Networking"));
+  system_header(client, _PAPPL_LOC("Networking"), 0);
 
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
@@ -984,7 +1250,7 @@ _papplSystemWebNetwork(
       _PAPPL_LOC("on")
     };
 
-    if ((system->wifi_status_cb)(system, system->wifi_cbdata, &wifi_info))
+    if (_papplSystemGetWiFiStatus(system, &wifi_info))
     {
       papplClientHTMLPrintf(client, "              <tr><th>%s:</th><td>%s (%s)", papplClientGetLocString(client, _PAPPL_LOC("Wi-Fi Network")), wifi_info.ssid, papplClientGetLocString(client, wifi_statuses[wifi_info.state - PAPPL_WIFI_STATE_OFF]));
       if (system->wifi_list_cb)
@@ -1205,7 +1471,7 @@ _papplSystemWebSecurity(
     cupsFreeOptions(num_form, form);
   }
 
-  system_header(client, _PAPPL_LOC("Security"));
+  system_header(client, _PAPPL_LOC("Security"), 0);
 
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
@@ -1342,8 +1608,9 @@ _papplSystemWebSettings(
     papplClientHTMLPuts(client, "</div>\n");
   }
 
-  if ((client->system->options & PAPPL_SOPTIONS_WEB_LOG) && client->system->logfile && strcmp(client->system->logfile, "-") && strcmp(client->system->logfile, "syslog"))
+  if (client->system->options & PAPPL_SOPTIONS_WEB_LOG)
   {
+    // Logging links include the log file (if any) and memory usage pages...
     papplClientHTMLPrintf(client,
                           "          <h2 class=\"title\">%s</h2>\n"
                           "          <div class=\"btn\">", papplClientGetLocString(client, _PAPPL_LOC("Logging")));
@@ -1421,7 +1688,7 @@ _papplSystemWebTLSInstall(
     cupsFreeOptions(num_form, form);
   }
 
-  system_header(client, _PAPPL_LOC("Install TLS Certificate"));
+  system_header(client, _PAPPL_LOC("Install TLS Certificate"), 0);
 
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
@@ -1466,6 +1733,10 @@ _papplSystemWebTLSNew(
   const char	*status = NULL;		// Status message, if any
   char		crqpath[256] = "";	// Certificate request file, if any
   bool		success = false;	// Were we successful?
+  bool		csr = strcmp(client->uri, "/tls-new-crt") != 0;
+					// Creating a certificate request?
+  _pappl_tlsgen_t state;		// Credential generation state
+  int		progress;		// Credential generation progress
 
 
   if (!papplClientHTMLAuthorize(client))
@@ -1484,34 +1755,72 @@ _papplSystemWebTLSNew(
     {
       status = _PAPPL_LOC("Invalid form submission.");
     }
-    else if (!strcmp(client->uri, "/tls-new-crt"))
+    else if (tls_start_credentials(system, csr, num_form, form))
     {
-      if (tls_make_certificate(client, num_form, form))
-      {
-        status  = _PAPPL_LOC("Certificate created.");
-        success = true;
-      }
-      else
-        status = _PAPPL_LOC("Unable to create certificate.");
+      // Keys are generated in the background (the form variables now belong
+      // to the generation thread), redirect to show the progress...
+      papplClientRespondRedirect(client, HTTP_STATUS_FOUND, client->uri);
+      return;
+    }
+    else if (csr)
+    {
+      status = _PAPPL_LOC("Unable to create certificate request.");
     }
     else
     {
-      if (tls_make_certsignreq(client, num_form, form, crqpath, sizeof(crqpath)))
-      {
-        status  = _PAPPL_LOC("Certificate request created.");
-        success = true;
-      }
-      else
-        status = _PAPPL_LOC("Unable to create certificate request.");
+      status = _PAPPL_LOC("Unable to create certificate.");
     }
 
     cupsFreeOptions(num_form, form);
   }
 
-  if (!strcmp(client->uri, "/tls-new-crt"))
-    system_header(client, _PAPPL_LOC("Create New TLS Certificate"));
+  // Get the state of any background credential generation...
+  pthread_mutex_lock(&system->tls_mutex);
+
+  state    = system->tls_state;
+  progress = system->tls_progress;
+
+  if (!status && system->tls_csr == csr && (state == _PAPPL_TLSGEN_SUCCESS || state == _PAPPL_TLSGEN_ERROR))
+  {
+    // Report the result once, then show the form again on the next visit...
+    if (state == _PAPPL_TLSGEN_ERROR)
+    {
+      status = csr ? _PAPPL_LOC("Unable to create certificate request.") : _PAPPL_LOC("Unable to create certificate.");
+    }
+    else
+    {
+      status  = csr ? _PAPPL_LOC("Certificate request created.") : _PAPPL_LOC("Certificate created.");
+      success = true;
+
+      if (csr)
+        papplCopyString(crqpath, system->tls_crqpath, sizeof(crqpath));
+    }
+
+    system->tls_state = _PAPPL_TLSGEN_IDLE;
+  }
+
+  pthread_mutex_unlock(&system->tls_mutex);
+
+  if (state == _PAPPL_TLSGEN_RUNNING)
+  {
+    // Show the progress and poll until the keys have been generated...
+    char	text[256];		// Localized progress message
+
+    system_header(client, csr ? _PAPPL_LOC("Create TLS Certificate Request") : _PAPPL_LOC("Create New TLS Certificate"), 2);
+
+    papplLocFormatString(papplClientGetLoc(client), text, sizeof(text), _PAPPL_LOC("Creating TLS credentials, %d%% complete."), progress);
+    papplClientHTMLPrintf(client,
+                          "          <div class=\"banner\">%s</div>\n"
+                          "        </div>\n"
+                          "      </div>\n", text);
+    system_footer(client);
+    return;
+  }
+
+  if (!csr)
+    system_header(client, _PAPPL_LOC("Create New TLS Certificate"), 0);
   else
-    system_header(client, _PAPPL_LOC("Create TLS Certificate Request"));
+    system_header(client, _PAPPL_LOC("Create TLS Certificate Request"), 0);
 
   if (status)
   {
@@ -1537,7 +1846,7 @@ _papplSystemWebTLSNew(
 
   papplClientHTMLStartForm(client, client->uri, false);
 
-  if (!strcmp(client->uri, "/tls-new-crt"))
+  if (!csr)
     papplClientHTMLPrintf(client,
 			  "        <div class=\"col-12\">\n"
 			  "          <p>%s</p>\n"
@@ -1552,18 +1861,18 @@ _papplSystemWebTLSNew(
 			  "            <tbody>\n", papplClientGetLocString(client, _PAPPL_LOC("This form creates a certificate signing request ('CSR') that you can send to a Certificate Authority ('CA') to obtain a trusted TLS certificate. The private key is saved separately for use with the certificate you get from the CA.")));
 
   papplClientHTMLPrintf(client,
-			"              <tr><th><label for=\"level\">%s:</label></th><td><select name=\"level\"><option value=\"rsa-2048\">%s</option><option value=\"rsa-4096\">%s</option><option value=\"ecdsa-p384\">%s</option></select></td></tr>\n"
+			"              <tr><th><label for=\"level\">%s:</label></th><td><select name=\"level\"><option value=\"ecdsa-p384\" selected>%s</option><option value=\"rsa-2048\">%s</option><option value=\"rsa-4096\">%s</option></select></td></tr>\n"
 			"              <tr><th><label for=\"email\">%s:</label></th><td><input type=\"email\" name=\"email\" value=\"%s\" placeholder=\"name@example.com\"></td></tr>\n"
 			"              <tr><th><label for=\"organization\">%s:</label></th><td><input type=\"text\" name=\"organization\" value=\"%s\" placeholder=\"%s\"></td></tr>\n"
 			"              <tr><th><label for=\"organizational_unit\">%s:</label></th><td><input type=\"text\" name=\"organizational_unit\" value=\"%s\" placeholder=\"%s\"></td></tr>\n"
 			"              <tr><th><label for=\"city\">%s:</label></th><td><input type=\"text\" name=\"city\" placeholder=\"%s\">  <button id=\"address_lookup\" onClick=\"event.preventDefault(); navigator.geolocation.getCurrentPosition(setAddress);\">%s</button></td></tr>\n"
 			"              <tr><th><label for=\"state\">%s:</label></th><td><input type=\"text\" name=\"state\" placeholder=\"%s\"></td></tr>\n"
-			"              <tr><th><label for=\"country\">%s:</label></th><td><select name=\"country\"><option value="">%s</option>", papplClientGetLocString(client, _PAPPL_LOC("Level")), papplClientGetLocString(client, _PAPPL_LOC("Good (2048-bit RSA)")), papplClientGetLocString(client, _PAPPL_LOC("Better (4096-bit RSA)")), papplClientGetLocString(client, _PAPPL_LOC("Best (384-bit ECC)")), papplClientGetLocString(client, _PAPPL_LOC("EMail (contact)")), system->contact.email, papplClientGetLocString(client, _PAPPL_LOC("Organization")), system->organization ? system->organization : "", papplClientGetLocString(client, _PAPPL_LOC("Organization/business name")), papplClientGetLocString(client, _PAPPL_LOC("Organization Unit")), system->org_unit ? system->org_unit : "", papplClientGetLocString(client, _PAPPL_LOC("Unit, department, etc.")), papplClientGetLocString(client, _PAPPL_LOC("City/Locality")), papplClientGetLocString(client, _PAPPL_LOC("City/town name")), papplClientGetLocString(client, _PAPPL_LOC("Use My Position")), papplClientGetLocString(client, _PAPPL_LOC("State/Province")), papplClientGetLocString(client, _PAPPL_LOC("State/province name")), papplClientGetLocString(client, _PAPPL_LOC("Country or Region")), papplClientGetLocString(client, _PAPPL_LOC("Choose")));
+			"              <tr><th><label for=\"country\">%s:</label></th><td><select name=\"country\"><option value="">%s</option>", papplClientGetLocString(client, _PAPPL_LOC("Level")), papplClientGetLocString(client, _PAPPL_LOC("Best (384-bit ECC)")), papplClientGetLocString(client, _PAPPL_LOC("Good (2048-bit RSA)")), papplClientGetLocString(client, _PAPPL_LOC("Better (4096-bit RSA)")), papplClientGetLocString(client, _PAPPL_LOC("EMail (contact)")), system->contact.email, papplClientGetLocString(client, _PAPPL_LOC("Organization")), system->organization ? system->organization : "", papplClientGetLocString(client, _PAPPL_LOC("Organization/business name")), papplClientGetLocString(client, _PAPPL_LOC("Organization Unit")), system->org_unit ? system->org_unit : "", papplClientGetLocString(client, _PAPPL_LOC("Unit, department, etc.")), papplClientGetLocString(client, _PAPPL_LOC("City/Locality")), papplClientGetLocString(client, _PAPPL_LOC("City/town name")), papplClientGetLocString(client, _PAPPL_LOC("Use My Position")), papplClientGetLocString(client, _PAPPL_LOC("State/Province")), papplClientGetLocString(client, _PAPPL_LOC("State/province name")), papplClientGetLocString(client, _PAPPL_LOC("Country or Region")), papplClientGetLocString(client, _PAPPL_LOC("Choose")));
 
   for (i = 0; i < (int)(sizeof(countries) / sizeof(countries[0])); i ++)
     papplClientHTMLPrintf(client, "<option value=\"%s\">%s</option>", countries[i][0], papplClientGetLocString(client, countries[i][1]));
 
-  if (!strcmp(client->uri, "/tls-new-crt"))
+  if (!csr)
     papplClientHTMLPrintf(client,
 			  "</select></td></tr>\n"
 			  "              <tr><th></th><td><input type=\"submit\" value=\"%s\"></td></tr>\n", papplClientGetLocString(client, _PAPPL_LOC("Create New Certificate")));
@@ -1654,6 +1963,8 @@ _papplSystemWebWiFi(
         status = _PAPPL_LOC("Joining Wi-Fi network.");
       else
         status = _PAPPL_LOC("Unable to join Wi-Fi network.");
+
+      papplSystemSetWiFiStatus(system, NULL);
     }
     else
     {
@@ -1664,7 +1975,7 @@ _papplSystemWebWiFi(
   }
 
   // Show the Wi-Fi configuration
-  system_header(client, _PAPPL_LOC("Wi-Fi Configuration"));
+  system_header(client, _PAPPL_LOC("Wi-Fi Configuration"), 0);
 
   if (status)
     papplClientHTMLPrintf(client, "<div class=\"banner\">%s</div>\n", papplClientGetLocString(client, status));
@@ -1692,6 +2003,139 @@ _papplSystemWebWiFi(
 }
 
 
+//
+// 'compare_printer_locations()' - Compare two printers by location.
+//
+
+static int				// O - Result of comparison
+compare_printer_locations(
+    _pappl_system_printer_t *a,		// I - First printer
+    _pappl_system_printer_t *b)		// I - Second printer
+{
+  int	result;				// Result of comparison
+
+
+  if ((result = strcasecmp(a->location, b->location)) == 0)
+    result = compare_printer_names(a, b);
+
+  return (result);
+}
+
+
+//
+// 'compare_printer_names()' - Compare two printers by name.
+//
+
+static int				// O - Result of comparison
+compare_printer_names(
+    _pappl_system_printer_t *a,		// I - First printer
+    _pappl_system_printer_t *b)		// I - Second printer
+{
+  return (strcasecmp(a->name, b->name));
+}
+
+
+//
+// 'compare_printer_states()' - Compare two printers by state.
+//
+// Stopped printers are listed first, followed by processing and idle printers.
+//
+
+static int				// O - Result of comparison
+compare_printer_states(
+    _pappl_system_printer_t *a,		// I - First printer
+    _pappl_system_printer_t *b)		// I - Second printer
+{
+  if (a->state > b->state)
+    return (-1);
+  else if (a->state < b->state)
+    return (1);
+  else
+    return (compare_printer_names(a, b));
+}
+
+
+//
+// 'match_printer()' - Match a printer against a filter string.
+//
+// The filter is matched, ignoring case, against the printer name, location,
+// and make and model.  The caller must hold a read lock on the printer.
+//
+
+static bool				// O - `true` on match, `false` otherwise
+match_printer(
+    pappl_printer_t *printer,		// I - Printer
+    const char      *filter)		// I - Filter string
+{
+  size_t	i,			// Looping var
+		len = strlen(filter);	// Length of filter string
+  const char	*s,			// Pointer into string
+		*strings[3];		// Strings to match
+
+
+  strings[0] = printer->name;
+  strings[1] = printer->location;
+  strings[2] = printer->driver_data.make_and_model;
+
+  for (i = 0; i < (sizeof(strings) / sizeof(strings[0])); i ++)
+  {
+    if (!strings[i])
+      continue;
+
+    for (s = strings[i]; *s; s ++)
+    {
+      if (!strncasecmp(s, filter, len))
+        return (true);
+    }
+  }
+
+  return (false);
+}
+
+
+//
+// 'printer_pager()' - Show the printer list pager.
+//
+
+static void
+printer_pager(
+    pappl_client_t *client,		// I - Client
+    size_t         num_printers,	// I - Number of printers
+    int            printer_index,	// I - First printer shown (1-based)
+    int            limit,		// I - Maximum printers shown
+    const char     *query)		// I - Additional query string
+{
+  int	num_pages,			// Number of pages
+	i,				// Looping var
+	page;				// Current page
+
+
+  if (num_printers <= (size_t)limit)
+    return;
+
+  num_pages = (int)((num_printers + (size_t)limit - 1) / (size_t)limit);
+  page      = (printer_index - 1) / limit;
+
+  papplClientHTMLPuts(client, "          <div class=\"pager\">");
+
+  if (page > 0)
+    papplClientHTMLPrintf(client, "<a class=\"btn\" href=\"/?printer-index=%d%s\">&laquo;</a>", (page - 1) * limit + 1, query);
+
+  for (i = 0; i < num_pages; i ++)
+  {
+    if (i == page)
+      papplClientHTMLPrintf(client, " %d", i + 1);
+    else
+      papplClientHTMLPrintf(client, " <a class=\"btn\" href=\"/?printer-index=%d%s\">%d</a>", i * limit + 1, query, i + 1);
+  }
+
+  if (page < (num_pages - 1))
+    papplClientHTMLPrintf(client, " <a class=\"btn\" href=\"/?printer-index=%d%s\">&raquo;</a>", (page + 1) * limit + 1, query);
+
+  papplClientHTMLPuts(client, "</div>\n");
+}
+
+
 //
 // 'system_device_cb()' - Device callback for the "add printer" chooser.
 //
@@ -1732,7 +2176,8 @@ system_footer(pappl_client_t *client)	// I - Client
 
 static void
 system_header(pappl_client_t *client,	// I - Client
-              const char     *title)	// I - Title
+              const char     *title,	// I - Title
+              int            refresh)	// I - Refresh time in seconds (`0` for no refresh)
 {
   char	text[1024];			// Localized version number
 
@@ -1740,7 +2185,7 @@ system_header(pappl_client_t *client,	// I - Client
   if (!papplClientRespond(client, HTTP_STATUS_OK, NULL, "text/html", 0, 0))
     return;
 
-  papplClientHTMLHeader(client, title, 0);
+  papplClientHTMLHeader(client, title, refresh);
 
   if (client->system->versions[0].sversion[0])
   {
@@ -1854,6 +2299,9 @@ tls_install_certificate(
     return (false);
   }
 
+  // Use the new credentials for new connections...
+  tls_use_credentials(system);
+
   // If we get this far we are done!
   return (true);
 }
@@ -1918,13 +2366,11 @@ tls_install_file(
 
 static bool				// O - `true` on success, `false` otherwise
 tls_make_certificate(
-    pappl_client_t *client,		// I - Client
+    pappl_system_t *system,		// I - System
     cups_len_t     num_form,		// I - Number of form variables
     cups_option_t  *form)		// I - Form variables
 {
   int		i;			// Looping var
-  pappl_system_t *system = papplClientGetSystem(client);
-					// System
   const char	*home,			// Home directory
 		*value,			// Value from form variables
 		*level,			// Level/algorithm+bits
@@ -1942,7 +2388,9 @@ tls_make_certificate(
 		basedir[256],		// CUPS directory
 		ssldir[256],		// CUPS "ssl" directory
 		crtfile[1024],		// Certificate file
-		keyfile[1024];		// Private key file
+		crttemp[1024],		// Temporary certificate file
+		keyfile[1024],		// Private key file
+		keytemp[1024];		// Temporary private key file
 #  ifdef HAVE_OPENSSL
   bool		result = false;		// Result of operations
   EVP_PKEY	*pkey;			// Private key
@@ -1970,54 +2418,54 @@ tls_make_certificate(
   // Verify that we have all of the required form variables...
   if ((value = cupsGetOption("duration", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'duration' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'duration' form field.");
     return (false);
   }
   else if ((duration = (int)strtol(value, NULL, 10)) < 1 || duration > 10)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Bad 'duration'='%s' form field.", value);
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Bad 'duration'='%s' form field.", value);
     return (false);
   }
 
   if ((level = cupsGetOption("level", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'level' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'level' form field.");
     return (false);
   }
 
   if ((email = cupsGetOption("email", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'email' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'email' form field.");
     return (false);
   }
 
   if ((organization = cupsGetOption("organization", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'organization' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'organization' form field.");
     return (false);
   }
 
   if ((org_unit = cupsGetOption("organizational_unit", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'organizational_unit' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'organizational_unit' form field.");
     return (false);
   }
 
   if ((city = cupsGetOption("city", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'city' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'city' form field.");
     return (false);
   }
 
   if ((state = cupsGetOption("state", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'state' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'state' form field.");
     return (false);
   }
 
   if ((country = cupsGetOption("country", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'country' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'country' form field.");
     return (false);
   }
 
@@ -2052,7 +2500,7 @@ tls_make_certificate(
     // Make "~/.cups" or "CUPS_SERVERROOT" directory...
     if (mkdir(basedir, 0755))
     {
-      papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create directory '%s': %s", basedir, strerror(errno));
+      papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create directory '%s': %s", basedir, strerror(errno));
       return (false);
     }
   }
@@ -2063,21 +2511,26 @@ tls_make_certificate(
     // Make "~/.cups/ssl" or "CUPS_SERVERROOT/ssl" directory...
     if (mkdir(ssldir, 0755))
     {
-      papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create directory '%s': %s", ssldir, strerror(errno));
+      papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create directory '%s': %s", ssldir, strerror(errno));
       return (false);
     }
   }
 
+  // The new key and certificate are written to temporary files and then
+  // renamed so that TLS sessions never see a partial key/certificate pair...
   snprintf(keyfile, sizeof(keyfile), "%s/%s.key", ssldir, hostname);
+  snprintf(keytemp, sizeof(keytemp), "%s/%s.key.tmp", ssldir, hostname);
   snprintf(crtfile, sizeof(crtfile), "%s/%s.crt", ssldir, hostname);
+  snprintf(crttemp, sizeof(crttemp), "%s/%s.crt.tmp", ssldir, hostname);
 
-  papplLogClient(client, PAPPL_LOGLEVEL_DEBUG, "Creating crtfile='%s', keyfile='%s'.", crtfile, keyfile);
+  papplLog(system, PAPPL_LOGLEVEL_DEBUG, "Creating crtfile='%s', keyfile='%s'.", crtfile, keyfile);
+  tls_set_progress(system, 10);
 
 #  ifdef HAVE_OPENSSL
   // Create the paired encryption keys...
   if ((pkey = EVP_PKEY_new()) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create private key.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create private key.");
     return (false);
   }
 
@@ -2107,7 +2560,7 @@ tls_make_certificate(
 
   if (!rsa && !ecdsa)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create RSA/ECDSA key pair.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create RSA/ECDSA key pair.");
     return (false);
   }
 
@@ -2116,11 +2569,13 @@ tls_make_certificate(
   else
     EVP_PKEY_assign_EC_KEY(pkey, ecdsa);
 
+  tls_set_progress(system, 60);
+
   // Create the self-signed certificate...
   if ((cert = X509_new()) == NULL)
   {
     EVP_PKEY_free(pkey);
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create X.509 certificate.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create X.509 certificate.");
     return (false);
   }
 
@@ -2163,33 +2618,34 @@ tls_make_certificate(
   }
 
   X509_sign(cert, pkey, EVP_sha256());
+  tls_set_progress(system, 80);
 
   // Save them...
-  if ((bio = BIO_new_file(keyfile, "wb")) == NULL)
+  if ((bio = BIO_new_file(keytemp, "wb")) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create key file '%s': %s", keyfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create key file '%s': %s", keytemp, strerror(errno));
     goto done;
   }
 
   if (!PEM_write_bio_PrivateKey(bio, pkey, NULL, NULL, 0, NULL, NULL))
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to write key file '%s': %s", keyfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to write key file '%s': %s", keytemp, strerror(errno));
     BIO_free(bio);
     goto done;
   }
 
   BIO_free(bio);
 
-  if ((bio = BIO_new_file(crtfile, "wb")) == NULL)
+  if ((bio = BIO_new_file(crttemp, "wb")) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create certificate file '%s': %s", crtfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create certificate file '%s': %s", crttemp, strerror(errno));
     goto done;
   }
 
   if (!PEM_write_bio_X509(bio, cert))
   {
     BIO_free(bio);
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to write certificate file '%s': %s", crtfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to write certificate file '%s': %s", crttemp, strerror(errno));
     goto done;
   }
 
@@ -2204,7 +2660,11 @@ tls_make_certificate(
   EVP_PKEY_free(pkey);
 
   if (!result)
+  {
+    unlink(keytemp);
+    unlink(crttemp);
     return (false);
+  }
 
 
 #  else // HAVE_GNUTLS
@@ -2218,23 +2678,25 @@ tls_make_certificate(
   else
     gnutls_x509_privkey_generate(key, GNUTLS_PK_ECDSA, 384, 0);
 
+  tls_set_progress(system, 60);
+
   // Save the private key...
   bytes = sizeof(buffer);
 
   if ((status = gnutls_x509_privkey_export(key, GNUTLS_X509_FMT_PEM, buffer, &bytes)) < 0)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to export private key: %s", gnutls_strerror(status));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to export private key: %s", gnutls_strerror(status));
     gnutls_x509_privkey_deinit(key);
     return (false);
   }
-  else if ((fp = cupsFileOpen(keyfile, "w")) != NULL)
+  else if ((fp = cupsFileOpen(keytemp, "w")) != NULL)
   {
     cupsFileWrite(fp, (char *)buffer, bytes);
     cupsFileClose(fp);
   }
   else
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create private key file '%s': %s", keyfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create private key file '%s': %s", keytemp, strerror(errno));
     gnutls_x509_privkey_deinit(key);
     return (false);
   }
@@ -2271,26 +2733,29 @@ tls_make_certificate(
     gnutls_x509_crt_set_subject_key_id(crt, buffer, bytes);
 
   gnutls_x509_crt_sign(crt, crt, key);
+  tls_set_progress(system, 80);
 
   // Save the certificate and public key...
   bytes = sizeof(buffer);
   if ((status = gnutls_x509_crt_export(crt, GNUTLS_X509_FMT_PEM, buffer, &bytes)) < 0)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to export public key and X.509 certificate: %s", gnutls_strerror(status));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to export public key and X.509 certificate: %s", gnutls_strerror(status));
     gnutls_x509_crt_deinit(crt);
     gnutls_x509_privkey_deinit(key);
+    unlink(keytemp);
     return (false);
   }
-  else if ((fp = cupsFileOpen(crtfile, "w")) != NULL)
+  else if ((fp = cupsFileOpen(crttemp, "w")) != NULL)
   {
     cupsFileWrite(fp, (char *)buffer, bytes);
     cupsFileClose(fp);
   }
   else
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create public key and X.509 certificate file '%s': %s", crtfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create public key and X.509 certificate file '%s': %s", crttemp, strerror(errno));
     gnutls_x509_crt_deinit(crt);
     gnutls_x509_privkey_deinit(key);
+    unlink(keytemp);
     return (false);
   }
 
@@ -2300,6 +2765,15 @@ tls_make_certificate(
   gnutls_x509_privkey_deinit(key);
 #  endif // HAVE_OPENSSL
 
+  // Move the new private key and certificate into place...
+  if (rename(keytemp, keyfile) || rename(crttemp, crtfile))
+  {
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to install new private key and certificate: %s", strerror(errno));
+    unlink(keytemp);
+    unlink(crttemp);
+    return (false);
+  }
+
   // Create symlinks for each of the alternate names...
 #  if _WIN32
 #    define symlink(src,dst) CreateSymbolicLinkA(dst,src,SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE)
@@ -2328,14 +2802,12 @@ tls_make_certificate(
 
 static bool				// O - `true` on success, `false` otherwise
 tls_make_certsignreq(
-    pappl_client_t *client,		// I - Client
+    pappl_system_t *system,		// I - System
     cups_len_t     num_form,		// I - Number of form variables
     cups_option_t  *form,		// I - Form variables
     char           *crqpath,		// I - Certificate request filename buffer
     size_t         crqsize)		// I - Size of certificate request buffer
 {
-  pappl_system_t *system = papplClientGetSystem(client);
-					// System
   const char	*level,			// Level/algorithm+bits
 		*email,			// Email address
 		*organization,		// Organization name
@@ -2374,43 +2846,43 @@ tls_make_certsignreq(
   // Verify that we have all of the required form variables...
   if ((level = cupsGetOption("level", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'level' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'level' form field.");
     return (false);
   }
 
   if ((email = cupsGetOption("email", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'email' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'email' form field.");
     return (false);
   }
 
   if ((organization = cupsGetOption("organization", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'organization' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'organization' form field.");
     return (false);
   }
 
   if ((org_unit = cupsGetOption("organizational_unit", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'organizational_unit' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'organizational_unit' form field.");
     return (false);
   }
 
   if ((city = cupsGetOption("city", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'city' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'city' form field.");
     return (false);
   }
 
   if ((state = cupsGetOption("state", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'state' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'state' form field.");
     return (false);
   }
 
   if ((country = cupsGetOption("country", num_form, form)) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Missing 'country' form field.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Missing 'country' form field.");
     return (false);
   }
 
@@ -2419,11 +2891,13 @@ tls_make_certsignreq(
   snprintf(crqfile, sizeof(crqfile), "%s/%s.csr", system->directory, hostname);
   snprintf(crqpath, crqsize, "/%s.csr", hostname);
 
+  tls_set_progress(system, 10);
+
 #  ifdef HAVE_OPENSSL
   // Create the paired encryption keys...
   if ((pkey = EVP_PKEY_new()) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create private key.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create private key.");
     return (false);
   }
 
@@ -2453,7 +2927,7 @@ tls_make_certsignreq(
 
   if (!rsa && !ecdsa)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create RSA/ECDSA key pair.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create RSA/ECDSA key pair.");
     return (false);
   }
 
@@ -2462,11 +2936,13 @@ tls_make_certsignreq(
   else
     EVP_PKEY_assign_EC_KEY(pkey, ecdsa);
 
+  tls_set_progress(system, 60);
+
   // Create the certificate request...
   if ((crq = X509_REQ_new()) == NULL)
   {
     EVP_PKEY_free(pkey);
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create X.509 certificate request.");
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create X.509 certificate request.");
     return (false);
   }
 
@@ -2505,17 +2981,18 @@ tls_make_certsignreq(
   ASN1_OCTET_STRING_free(san_asn1);
 
   X509_REQ_sign(crq, pkey, EVP_sha256());
+  tls_set_progress(system, 80);
 
   // Save them...
   if ((bio = BIO_new_file(keyfile, "wb")) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create key file '%s': %s", keyfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create key file '%s': %s", keyfile, strerror(errno));
     goto done;
   }
 
   if (!PEM_write_bio_PrivateKey(bio, pkey, NULL, NULL, 0, NULL, NULL))
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to write key file '%s': %s", keyfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to write key file '%s': %s", keyfile, strerror(errno));
     BIO_free(bio);
     goto done;
   }
@@ -2524,14 +3001,14 @@ tls_make_certsignreq(
 
   if ((bio = BIO_new_file(crqfile, "wb")) == NULL)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create certificate request file '%s': %s", crqfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create certificate request file '%s': %s", crqfile, strerror(errno));
     goto done;
   }
 
   if (!PEM_write_bio_X509_REQ(bio, crq))
   {
     BIO_free(bio);
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to write certificate request file '%s': %s", crqfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to write certificate request file '%s': %s", crqfile, strerror(errno));
     goto done;
   }
 
@@ -2559,12 +3036,14 @@ tls_make_certsignreq(
   else
     gnutls_x509_privkey_generate(key, GNUTLS_PK_ECDSA, 384, 0);
 
+  tls_set_progress(system, 60);
+
   // Save the private key...
   bytes = sizeof(buffer);
 
   if ((status = gnutls_x509_privkey_export(key, GNUTLS_X509_FMT_PEM, buffer, &bytes)) < 0)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to export private key: %s", gnutls_strerror(status));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to export private key: %s", gnutls_strerror(status));
     gnutls_x509_privkey_deinit(key);
     return (false);
   }
@@ -2575,7 +3054,7 @@ tls_make_certsignreq(
   }
   else
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create private key file '%s': %s", keyfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create private key file '%s': %s", keyfile, strerror(errno));
     gnutls_x509_privkey_deinit(key);
     return (false);
   }
@@ -2596,12 +3075,13 @@ tls_make_certsignreq(
   gnutls_x509_crq_set_version(crq, 3);
 
   gnutls_x509_crq_sign2(crq, key, GNUTLS_DIG_SHA256, 0);
+  tls_set_progress(system, 80);
 
   // Save the certificate request and public key...
   bytes = sizeof(buffer);
   if ((status = gnutls_x509_crq_export(crq, GNUTLS_X509_FMT_PEM, buffer, &bytes)) < 0)
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to export public key and X.509 certificate request: %s", gnutls_strerror(status));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to export public key and X.509 certificate request: %s", gnutls_strerror(status));
     gnutls_x509_crq_deinit(crq);
     gnutls_x509_privkey_deinit(key);
     return (false);
@@ -2613,7 +3093,7 @@ tls_make_certsignreq(
   }
   else
   {
-    papplLogClient(client, PAPPL_LOGLEVEL_ERROR, "Unable to create public key and X.509 certificate request file '%s': %s", crqfile, strerror(errno));
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create public key and X.509 certificate request file '%s': %s", crqfile, strerror(errno));
     gnutls_x509_crq_deinit(crq);
     gnutls_x509_privkey_deinit(key);
     return (false);
@@ -2628,4 +3108,138 @@ tls_make_certsignreq(
 
   return (true);
 }
+
+
+//
+// 'tls_make_credentials()' - Make a certificate or certificate request in the
+//                            background.
+//
+
+static void *				// O - Thread exit status
+tls_make_credentials(
+    _pappl_tls_request_t *req)		// I - Generation request
+{
+  pappl_system_t *system = req->system;	// System
+  bool		ret;			// Return value
+  char		crqpath[256] = "";	// Certificate request path, if any
+
+
+  if (req->csr)
+    ret = tls_make_certsignreq(system, req->num_form, req->form, crqpath, sizeof(crqpath));
+  else if ((ret = tls_make_certificate(system, req->num_form, req->form)) == true)
+    tls_use_credentials(system);
+
+  cupsFreeOptions(req->num_form, req->form);
+  free(req);
+
+  pthread_mutex_lock(&system->tls_mutex);
+
+  system->tls_state    = ret ? _PAPPL_TLSGEN_SUCCESS : _PAPPL_TLSGEN_ERROR;
+  system->tls_progress = 100;
+  papplCopyString(system->tls_crqpath, crqpath, sizeof(system->tls_crqpath));
+
+  pthread_cond_broadcast(&system->tls_cond);
+  pthread_mutex_unlock(&system->tls_mutex);
+
+  return (NULL);
+}
+
+
+//
+// 'tls_set_progress()' - Update the progress of credential generation.
+//
+
+static void
+tls_set_progress(
+    pappl_system_t *system,		// I - System
+    int            progress)		// I - Progress (0-100)
+{
+  pthread_mutex_lock(&system->tls_mutex);
+  system->tls_progress = progress;
+  pthread_mutex_unlock(&system->tls_mutex);
+}
+
+
+//
+// 'tls_start_credentials()' - Start making a certificate or certificate
+//                             request in the background.
+//
+// On success the form variables are owned (and freed) by the background
+// thread.
+//
+
+static bool				// O - `true` on success, `false` otherwise
+tls_start_credentials(
+    pappl_system_t *system,		// I - System
+    bool           csr,			// I - Create a certificate signing request?
+    cups_len_t     num_form,		// I - Number of form variables
+    cups_option_t  *form)		// I - Form variables
+{
+  _pappl_tls_request_t	*req;		// Generation request
+
+
+  pthread_mutex_lock(&system->tls_mutex);
+
+  if (system->tls_state == _PAPPL_TLSGEN_RUNNING)
+  {
+    pthread_mutex_unlock(&system->tls_mutex);
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "TLS credentials are already being created.");
+    return (false);
+  }
+
+  if ((req = (_pappl_tls_request_t *)calloc(1, sizeof(_pappl_tls_request_t))) == NULL)
+  {
+    pthread_mutex_unlock(&system->tls_mutex);
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to allocate memory for TLS credential request: %s", strerror(errno));
+    return (false);
+  }
+
+  req->system   = system;
+  req->csr      = csr;
+  req->num_form = num_form;
+  req->form     = form;
+
+  system->tls_state      = _PAPPL_TLSGEN_RUNNING;
+  system->tls_csr        = csr;
+  system->tls_progress   = 0;
+  system->tls_crqpath[0] = '\0';
+
+  pthread_mutex_unlock(&system->tls_mutex);
+
+  // Create the credentials in a thread with the client thread scheduling...
+  if (!_papplSystemCreateThread(system, PAPPL_THREAD_JOB, NULL, (void *(*)(void *))tls_make_credentials, req))
+  {
+    papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create TLS credential thread: %s", strerror(errno));
+    free(req);
+
+    pthread_mutex_lock(&system->tls_mutex);
+    system->tls_state = _PAPPL_TLSGEN_IDLE;
+    pthread_cond_broadcast(&system->tls_cond);
+    pthread_mutex_unlock(&system->tls_mutex);
+
+    return (false);
+  }
+
+  return (true);
+}
+
+
+//
+// 'tls_use_credentials()' - Use new TLS credentials for new connections.
+//
+// The CUPS library loads the server credentials for each TLS session, so
+// resetting them is all that is needed for the listeners to use a new
+// certificate without restarting.
+//
+
+static void
+tls_use_credentials(
+    pappl_system_t *system)		// I - System
+{
+  pthread_rwlock_wrlock(&system->rwlock);
+  cupsSetServerCredentials(NULL, system->hostname, 1);
+  pthread_rwlock_unlock(&system->rwlock);
+
+  papplLog(system, PAPPL_LOGLEVEL_INFO, "Using new TLS credentials.");
+}
 #endif // HAVE_OPENSSL || HAVE_GNUTLS
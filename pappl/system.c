@@ -15,6 +15,26 @@
 #include "pappl-private.h"
 #include "resource-private.h"
 #include "device-private.h"
+#ifdef __linux
+#  include <sys/resource.h>
+#  include <sys/syscall.h>
+#endif // __linux
+
+
+//
+// Local types...
+//
+
+typedef struct _pappl_thread_data_s	// Thread startup data
+{
+  pappl_system_t	*system;		// System
+  void			*(*func)(void *);	// Thread function
+  void			*data;			// Thread function data
+  int			nice;			// Nice value
+  bool			has_affinity;		// Is the CPU affinity set?
+  unsigned char		affinity[PAPPL_MAX_CPU / 8];
+						// CPU affinity bitmask
+} _pappl_thread_data_t;
 
 
 //
@@ -29,7 +49,12 @@ static bool	restart_logging = false;// Restart logging?
 // Local functions...
 //
 
+static unsigned char *load_icon(pappl_printer_t *printer, const char *filename, size_t *datalen);
 static void	make_attributes(pappl_system_t *system);
+static void	*run_thread(_pappl_thread_data_t *tdata);
+#ifdef HAVE_LIBPNG
+static unsigned char *scale_icon(pappl_printer_t *printer, const void *data, size_t datalen, unsigned size, size_t *pngdatalen);
+#endif // HAVE_LIBPNG
 static void	sighup_handler(int sig);
 static void	sigterm_handler(int sig);
 
@@ -37,43 +62,104 @@ static void	sigterm_handler(int sig);
 //
 // '_papplSystemAddPrinterIcons()' - (Re)add printer icon resources.
 //
+// Icons are loaded into memory once so they can be served without any disk
+// I/O.  Missing sizes are scaled from the largest icon the driver provides,
+// falling back to the default icons when no driver icons are available.
+//
 
 void
 _papplSystemAddPrinterIcons(
     pappl_system_t  *system,		// I - System
     pappl_printer_t *printer)		// I - Printer
 {
+  int		i,			// Looping var
+		largest = -1;		// Largest icon provided by the driver
   char		path[256];		// Resource path
   pappl_icon_t	*icons = printer->driver_data.icons;
 					// Printer icons
+  unsigned char	*loaded[3] = { NULL, NULL, NULL };
+					// Loaded/scaled icons
+  const void	*data[3];		// Icon data
+  size_t	datalen[3];		// Length of icon data
+  static const char * const names[3] =	// Icon resource names
+  {
+    "icon-sm.png",
+    "icon-md.png",
+    "icon-lg.png"
+  };
+  static const unsigned sizes[3] =	// Icon sizes
+  {
+    48,
+    128,
+    512
+  };
+  static const void * const defdata[3] =// Default icon data
+  {
+    icon_sm_png,
+    icon_md_png,
+    icon_lg_png
+  };
+  static const size_t defdatalen[3] =	// Default icon lengths
+  {
+    sizeof(icon_sm_png),
+    sizeof(icon_md_png),
+    sizeof(icon_lg_png)
+  };
 
 
-  snprintf(path, sizeof(path), "%s/icon-sm.png", printer->uriname);
-  papplSystemRemoveResource(system, path);
-  if (icons[0].filename[0])
-    papplSystemAddResourceFile(system, path, "image/png", icons[0].filename);
-  else if (icons[0].data && icons[0].datalen)
-    papplSystemAddResourceData(system, path, "image/png", icons[0].data, icons[0].datalen);
-  else
-    papplSystemAddResourceData(system, path, "image/png", icon_sm_png, sizeof(icon_sm_png));
-
-  snprintf(path, sizeof(path), "%s/icon-md.png", printer->uriname);
-  papplSystemRemoveResource(system, path);
-  if (icons[1].filename[0])
-    papplSystemAddResourceFile(system, path, "image/png", icons[1].filename);
-  else if (icons[1].data && icons[1].datalen)
-    papplSystemAddResourceData(system, path, "image/png", icons[1].data, icons[1].datalen);
-  else
-    papplSystemAddResourceData(system, path, "image/png", icon_md_png, sizeof(icon_md_png));
-
-  snprintf(path, sizeof(path), "%s/icon-lg.png", printer->uriname);
-  papplSystemRemoveResource(system, path);
-  if (icons[2].filename[0])
-    papplSystemAddResourceFile(system, path, "image/png", icons[2].filename);
-  else if (icons[2].data && icons[2].datalen)
-    papplSystemAddResourceData(system, path, "image/png", icons[2].data, icons[2].datalen);
-  else
-    papplSystemAddResourceData(system, path, "image/png", icon_lg_png, sizeof(icon_lg_png));
+  // Load the icons provided by the driver...
+  for (i = 0; i < 3; i ++)
+  {
+    data[i]    = NULL;
+    datalen[i] = 0;
+
+    if (icons[i].filename[0])
+    {
+      if ((loaded[i] = load_icon(printer, icons[i].filename, datalen + i)) != NULL)
+        data[i] = loaded[i];
+    }
+    else if (icons[i].data && icons[i].datalen)
+    {
+      data[i]    = icons[i].data;
+      datalen[i] = icons[i].datalen;
+    }
+
+    if (data[i])
+      largest = i;
+  }
+
+  // Scale or default any missing icons...
+  for (i = 0; i < 3; i ++)
+  {
+    if (data[i])
+      continue;
+
+#ifdef HAVE_LIBPNG
+    if (largest >= 0 && (loaded[i] = scale_icon(printer, data[largest], datalen[largest], sizes[i], datalen + i)) != NULL)
+    {
+      data[i] = loaded[i];
+      continue;
+    }
+#endif // HAVE_LIBPNG
+
+    data[i]    = defdata[i];
+    datalen[i] = defdatalen[i];
+  }
+
+  // Replace the icon resources.  Other clients may still be sending the old
+  // icon data, so it is kept until the printer is deleted...
+  if (!printer->icons)
+    printer->icons = cupsArrayNew(NULL, NULL, NULL, 0, NULL, (cups_afree_cb_t)free);
+
+  for (i = 0; i < 3; i ++)
+  {
+    snprintf(path, sizeof(path), "%s/%s", printer->uriname, names[i]);
+    papplSystemRemoveResource(system, path);
+    papplSystemAddResourceData(system, path, "image/png", data[i], datalen[i]);
+
+    if (loaded[i])
+      cupsArrayAdd(printer->icons, loaded[i]);
+  }
 }
 
 
@@ -108,7 +194,7 @@ _papplSystemConfigChanged(
 // - `PAPPL_SOPTIONS_NONE`: No options.
 // - `PAPPL_SOPTIONS_DNSSD_HOST`: When resolving DNS-SD service name collisions,
 //   use the DNS-SD hostname instead of a serial number or UUID.
-// - `PAPPL_SOPTIONS_WEB_LOG`: Include the log file web page.
+// - `PAPPL_SOPTIONS_WEB_LOG`: Include the log file and memory usage web pages.
 // - `PAPPL_SOPTIONS_MULTI_QUEUE`: Support multiple printers.
 // - `PAPPL_SOPTIONS_WEB_NETWORK`: Include the network settings web page.
 // - `PAPPL_SOPTIONS_RAW_SOCKET`: Accept jobs via raw sockets starting on port
@@ -177,6 +263,12 @@ papplSystemCreate(
   pthread_mutex_init(&system->config_mutex, NULL);
   pthread_mutex_init(&system->subscription_mutex, NULL);
   pthread_cond_init(&system->subscription_cond, NULL);
+  pthread_mutex_init(&system->wifi_mutex, NULL);
+  pthread_cond_init(&system->wifi_cond, NULL);
+  pthread_mutex_init(&system->tls_mutex, NULL);
+  pthread_mutex_init(&system->running_mutex, NULL);
+  pthread_cond_init(&system->running_cond, NULL);
+  pthread_cond_init(&system->tls_cond, NULL);
 
   system->options           = options;
   system->start_time        = time(NULL);
@@ -195,6 +287,7 @@ papplSystemCreate(
   system->admin_gid         = (gid_t)-1;
   system->auth_service      = auth_service ? strdup(auth_service) : NULL;
   system->max_subscriptions = 100;
+  system->max_form_size     = 16 * 1024 * 1024;
 
   papplSystemSetMaxClients(system, 0);
 
@@ -267,6 +360,110 @@ papplSystemCreate(
 }
 
 
+//
+// '_papplSystemCreateThread()' - Create a detached thread using the scheduling
+//                                parameters for its class.
+//
+
+bool					// O - `true` on success, `false` on error
+_papplSystemCreateThread(
+    pappl_system_t *system,		// I - System
+    pappl_thread_t thread,		// I - Thread class
+    pthread_t      *tid,		// O - Thread ID or `NULL` if not needed
+    void           *(*func)(void *),	// I - Thread function
+    void           *data)		// I - Thread function data
+{
+  pthread_t		ltid;		// Local thread ID
+  pthread_attr_t	tattr;		// Thread creation attributes
+  const pappl_thread_sched_t *sched = system->thread_sched + thread;
+					// Scheduling parameters
+  _pappl_thread_data_t	*tdata = NULL;	// Thread startup data
+  int			err;		// Error code
+#ifdef __linux
+  size_t		i;		// Looping var
+  bool			has_affinity = false;
+					// Is the CPU affinity set?
+#endif // __linux
+  static const char * const threads[] =	// Thread class names
+  {
+    "client",
+    "device",
+    "job"
+  };
+
+
+  if (!tid)
+    tid = &ltid;
+
+  pthread_attr_init(&tattr);
+  pthread_attr_setdetachstate(&tattr, PTHREAD_CREATE_DETACHED);
+
+#if !_WIN32
+  if (sched->stack_size > 0 && (err = pthread_attr_setstacksize(&tattr, sched->stack_size)) != 0)
+    papplLog(system, PAPPL_LOGLEVEL_WARN, "Unable to set %s thread stack size to %lu bytes: %s", threads[thread], (unsigned long)sched->stack_size, strerror(err));
+
+  if (sched->policy)
+  {
+    struct sched_param	param;		// Scheduling parameters
+
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = sched->priority;
+
+    pthread_attr_setinheritsched(&tattr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&tattr, sched->policy);
+    pthread_attr_setschedparam(&tattr, &param);
+  }
+
+#  ifdef __linux
+  for (i = 0; i < sizeof(sched->affinity) && !has_affinity; i ++)
+    has_affinity = sched->affinity[i] != 0;
+
+  if (sched->nice || has_affinity)
+  {
+    // The nice value and CPU affinity are set by the new thread...
+    if ((tdata = (_pappl_thread_data_t *)calloc(1, sizeof(_pappl_thread_data_t))) != NULL)
+    {
+      tdata->system   = system;
+      tdata->func     = func;
+      tdata->data     = data;
+      tdata->nice         = sched->nice;
+      tdata->has_affinity = has_affinity;
+
+      memcpy(tdata->affinity, sched->affinity, sizeof(tdata->affinity));
+
+      func = (void *(*)(void *))run_thread;
+      data = tdata;
+    }
+  }
+#  endif // __linux
+#endif // !_WIN32
+
+  err = pthread_create(tid, &tattr, func, data);
+
+#if !_WIN32
+  if (err && sched->policy)
+  {
+    // Scheduling policies usually require privileges, try the default...
+    papplLog(system, PAPPL_LOGLEVEL_WARN, "Unable to use scheduling policy %d for %s thread: %s", sched->policy, threads[thread], strerror(err));
+
+    pthread_attr_setinheritsched(&tattr, PTHREAD_INHERIT_SCHED);
+    err = pthread_create(tid, &tattr, func, data);
+  }
+#endif // !_WIN32
+
+  pthread_attr_destroy(&tattr);
+
+  if (err)
+  {
+    free(tdata);
+    errno = err;
+    return (false);
+  }
+
+  return (true);
+}
+
+
 //
 // 'papplSystemDelete()' - Delete a system object.
 //
@@ -284,6 +481,18 @@ papplSystemDelete(
   if (!system || system->is_running)
     return;
 
+  // Wait for any TLS credential generation to finish...
+  pthread_mutex_lock(&system->tls_mutex);
+  while (system->tls_state == _PAPPL_TLSGEN_RUNNING)
+    pthread_cond_wait(&system->tls_cond, &system->tls_mutex);
+  pthread_mutex_unlock(&system->tls_mutex);
+
+  // Wait for any Wi-Fi status refresh to finish...
+  pthread_mutex_lock(&system->wifi_mutex);
+  while (system->wifi_refresh)
+    pthread_cond_wait(&system->wifi_cond, &system->wifi_mutex);
+  pthread_mutex_unlock(&system->wifi_mutex);
+
   _papplSystemUnregisterDNSSDNoLock(system);
 
   cupsArrayDelete(system->printers);
@@ -333,6 +542,13 @@ papplSystemDelete(
   pthread_rwlock_destroy(&system->session_rwlock);
   pthread_mutex_destroy(&system->config_mutex);
 
+  pthread_cond_destroy(&system->wifi_cond);
+  pthread_mutex_destroy(&system->wifi_mutex);
+  pthread_cond_destroy(&system->tls_cond);
+  pthread_mutex_destroy(&system->tls_mutex);
+  pthread_cond_destroy(&system->running_cond);
+  pthread_mutex_destroy(&system->running_mutex);
+
   free(system);
 }
 
@@ -399,7 +615,6 @@ papplSystemRun(pappl_system_t *system)	// I - System
   int			dns_sd_host_changes;
 					// Current number of host name changes
   pappl_printer_t	*printer;	// Current printer
-  pthread_attr_t	tattr;		// Thread creation attributes
   struct timeval	curtime;	// Current time
   time_t		next,		// Next time for scheduling...
 			subtime = 0;	// Subscription checking time
@@ -458,6 +673,11 @@ papplSystemRun(pappl_system_t *system)	// I - System
       papplSystemAddResourceCallback(system, "/security", "text/html", (pappl_resource_cb_t)_papplSystemWebSecurity, system);
       papplSystemAddLink(system, _PAPPL_LOC("Security"), "/security", PAPPL_LOPTIONS_OTHER | PAPPL_LOPTIONS_HTTPS_REQUIRED);
     }
+    if (system->options & PAPPL_SOPTIONS_WEB_LOG)
+    {
+      papplSystemAddResourceCallback(system, "/memory", "text/html", (pappl_resource_cb_t)_papplSystemWebMemory, system);
+      papplSystemAddLink(system, _PAPPL_LOC("Memory Usage"), "/memory", PAPPL_LOPTIONS_LOGGING | PAPPL_LOPTIONS_HTTPS_REQUIRED);
+    }
 #if defined(HAVE_GNUTLS) || defined(HAVE_OPENSSL)
     if (system->options & PAPPL_SOPTIONS_WEB_TLS)
     {
@@ -516,10 +736,6 @@ papplSystemRun(pappl_system_t *system)	// I - System
   // Make the static attributes...
   make_attributes(system);
 
-  // Start all child threads in a detached state...
-  pthread_attr_init(&tattr);
-  pthread_attr_setdetachstate(&tattr, PTHREAD_CREATE_DETACHED);
-
   // Advertise the system via DNS-SD as needed...
   if (system->dns_sd_name)
     _papplSystemRegisterDNSSDNoLock(system);
@@ -536,9 +752,7 @@ papplSystemRun(pappl_system_t *system)	// I - System
     // Start the raw socket listeners as needed...
     if ((system->options & PAPPL_SOPTIONS_RAW_SOCKET) && printer->num_raw_listeners > 0)
     {
-      pthread_t	tid;			// Thread ID
-
-      if (pthread_create(&tid, &tattr, (void *(*)(void *))_papplPrinterRunRaw, printer))
+      if (!_papplSystemCreateThread(system, PAPPL_THREAD_DEVICE, NULL, (void *(*)(void *))_papplPrinterRunRaw, printer))
       {
 	// Unable to create listener thread...
 	papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to create raw listener thread: %s", strerror(errno));
@@ -549,15 +763,21 @@ papplSystemRun(pappl_system_t *system)	// I - System
   // Start the USB gadget as needed...
   if ((system->options & PAPPL_SOPTIONS_USB_PRINTER) && (printer = papplSystemFindPrinter(system, NULL, system->default_printer_id, NULL)) != NULL)
   {
-    pthread_t	tid;			// Thread ID
-
-    if (pthread_create(&tid, &tattr, (void *(*)(void *))_papplPrinterRunUSB, printer))
+    if (!_papplSystemCreateThread(system, PAPPL_THREAD_DEVICE, NULL, (void *(*)(void *))_papplPrinterRunUSB, printer))
     {
       // Unable to create USB thread...
       papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to create USB gadget thread: %s", strerror(errno));
     }
   }
 
+  // Tell anyone waiting in papplSystemWaitRunning that we are up...
+  papplLog(system, PAPPL_LOGLEVEL_DEBUG, "System is running.");
+
+  pthread_mutex_lock(&system->running_mutex);
+  system->is_started = true;
+  pthread_cond_broadcast(&system->running_cond);
+  pthread_mutex_unlock(&system->running_mutex);
+
   // Loop until we are shutdown or have a hard error...
   for (;;)
   {
@@ -611,7 +831,7 @@ papplSystemRun(pappl_system_t *system)	// I - System
 	    system->num_clients ++;
 	    pthread_rwlock_unlock(&system->rwlock);
 
-	    if (pthread_create(&client->thread_id, &tattr, (void *(*)(void *))_papplClientRun, client))
+	    if (!_papplSystemCreateThread(system, PAPPL_THREAD_CLIENT, &client->thread_id, (void *(*)(void *))_papplClientRun, client))
 	    {
 	      // Unable to create client thread...
 	      papplLog(system, PAPPL_LOGLEVEL_ERROR, "Unable to create client thread: %s", strerror(errno));
@@ -696,9 +916,9 @@ papplSystemRun(pappl_system_t *system)	// I - System
       {
 	printer = (pappl_printer_t *)cupsArrayGetElement(system->printers, i);
 
-        pthread_rwlock_rdlock(&printer->rwlock);
+        pthread_rwlock_rdlock(&printer->jobs_rwlock);
         jcount += cupsArrayGetCount(printer->active_jobs);
-        pthread_rwlock_unlock(&printer->rwlock);
+        pthread_rwlock_unlock(&printer->jobs_rwlock);
       }
       pthread_rwlock_unlock(&system->rwlock);
 
@@ -741,8 +961,6 @@ papplSystemRun(pappl_system_t *system)	// I - System
   ippDelete(system->attrs);
   system->attrs = NULL;
 
-  pthread_attr_destroy(&tattr);
-
   if (system->dns_sd_name)
     _papplSystemUnregisterDNSSDNoLock(system);
 
@@ -763,12 +981,22 @@ papplSystemRun(pappl_system_t *system)	// I - System
 
   system->is_running = false;
 
+  // Wake up any jobs waiting for a device...
+  papplSystemRetryDevices(system, NULL);
+
   if ((system->options & PAPPL_SOPTIONS_USB_PRINTER) && (printer = papplSystemFindPrinter(system, NULL, system->default_printer_id, NULL)) != NULL)
   {
     // Wait for the USB gadget thread(s) to complete...
-    while (printer->usb_active)
-      usleep(100000);
+    _papplPrinterWaitThreads(printer);
   }
+
+  // Tell anyone waiting in papplSystemWaitRunning that shutdown is complete -
+  // this must be the last thing we do since the waiter may delete the
+  // system...
+  pthread_mutex_lock(&system->running_mutex);
+  system->is_started = false;
+  pthread_cond_broadcast(&system->running_cond);
+  pthread_mutex_unlock(&system->running_mutex);
 }
 
 
@@ -788,6 +1016,111 @@ papplSystemShutdown(
 }
 
 
+//
+// 'papplSystemWaitRunning()' - Wait for the system to start or stop running.
+//
+// This function waits for the system to finish starting up ("running" is
+// `true`) or to finish shutting down ("running" is `false`) in
+// @link papplSystemRun@, up to "msecs" milliseconds.  If "msecs" is `0` or
+// negative, the function waits indefinitely.
+//
+// The system has finished starting up when its listeners are accepting
+// connections and its printers have been started, so this function is
+// typically used by a thread that needs to interact with the system after
+// calling @link papplSystemRun@ in another thread.
+//
+
+bool					// O - `true` if the system is in the requested state, `false` on timeout
+papplSystemWaitRunning(
+    pappl_system_t *system,		// I - System
+    bool           running,		// I - `true` to wait for startup, `false` to wait for shutdown
+    int            msecs)		// I - Maximum time to wait in milliseconds, `0` for no limit
+{
+  bool			ret;		// Return value
+  struct timeval	curtime;	// Current time
+  struct timespec	timeout;	// Timeout
+
+
+  if (!system)
+    return (false);
+
+  gettimeofday(&curtime, NULL);
+  timeout.tv_sec  = curtime.tv_sec + msecs / 1000;
+  timeout.tv_nsec = curtime.tv_usec * 1000 + (msecs % 1000) * 1000000;
+
+  if (timeout.tv_nsec >= 1000000000)
+  {
+    timeout.tv_sec ++;
+    timeout.tv_nsec -= 1000000000;
+  }
+
+  pthread_mutex_lock(&system->running_mutex);
+
+  while (system->is_started != running)
+  {
+    if (msecs <= 0)
+      pthread_cond_wait(&system->running_cond, &system->running_mutex);
+    else if (pthread_cond_timedwait(&system->running_cond, &system->running_mutex, &timeout))
+      break;
+  }
+
+  ret = system->is_started == running;
+
+  pthread_mutex_unlock(&system->running_mutex);
+
+  return (ret);
+}
+
+
+//
+// 'load_icon()' - Load an icon file into memory.
+//
+
+static unsigned char *			// O - Icon data or `NULL` on error
+load_icon(pappl_printer_t *printer,	// I - Printer
+          const char      *filename,	// I - Icon filename
+          size_t          *datalen)	// O - Length of icon data
+{
+  int		fd;			// File descriptor
+  struct stat	fileinfo;		// File information
+  unsigned char	*data = NULL;		// Icon data
+  size_t	total = 0;		// Total bytes read
+  ssize_t	bytes;			// Bytes read
+
+
+  *datalen = 0;
+
+  if ((fd = open(filename, O_RDONLY | O_BINARY)) < 0)
+  {
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to open icon file '%s': %s", filename, strerror(errno));
+    return (NULL);
+  }
+
+  if (fstat(fd, &fileinfo) || fileinfo.st_size <= 0 || (data = malloc((size_t)fileinfo.st_size)) == NULL)
+  {
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to load icon file '%s': %s", filename, strerror(errno));
+    close(fd);
+    return (NULL);
+  }
+
+  while (total < (size_t)fileinfo.st_size && (bytes = read(fd, data + total, (size_t)fileinfo.st_size - total)) > 0)
+    total += (size_t)bytes;
+
+  close(fd);
+
+  if (total < (size_t)fileinfo.st_size)
+  {
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to read icon file '%s'.", filename);
+    free(data);
+    return (NULL);
+  }
+
+  *datalen = total;
+
+  return (data);
+}
+
+
 //
 // 'make_attributes()' - Make the static attributes for the system.
 //
@@ -940,6 +1273,175 @@ make_attributes(pappl_system_t *system)	// I - System
 }
 
 
+
+//
+// 'run_thread()' - Apply the nice value and CPU affinity for a new thread.
+//
+
+static void *				// O - Thread exit status
+run_thread(
+    _pappl_thread_data_t *tdata)	// I - Thread startup data
+{
+  void	*(*func)(void *) = tdata->func;	// Thread function
+  void	*data = tdata->data;		// Thread function data
+
+
+#ifdef __linux
+  pid_t	tid = (pid_t)syscall(SYS_gettid);
+					// Kernel thread ID
+
+  if (tdata->nice && setpriority(PRIO_PROCESS, (id_t)tid, tdata->nice))
+    papplLog(tdata->system, PAPPL_LOGLEVEL_WARN, "Unable to set thread nice value to %d: %s", tdata->nice, strerror(errno));
+
+  if (tdata->has_affinity)
+  {
+#  ifdef HAVE_PTHREAD_SETAFFINITY_NP
+    int		cpu,			// Looping var
+		err;			// Error code
+    cpu_set_t	cpus;			// CPU set
+
+    CPU_ZERO(&cpus);
+
+    for (cpu = 0; cpu < PAPPL_MAX_CPU && cpu < CPU_SETSIZE; cpu ++)
+    {
+      if (tdata->affinity[cpu / 8] & (1 << (cpu % 8)))
+        CPU_SET(cpu, &cpus);
+    }
+
+    if ((err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus)) != 0)
+      papplLog(tdata->system, PAPPL_LOGLEVEL_WARN, "Unable to set thread CPU affinity: %s", strerror(err));
+
+#  else
+    papplLog(tdata->system, PAPPL_LOGLEVEL_WARN, "Unable to set thread CPU affinity: Not supported.");
+#  endif // HAVE_PTHREAD_SETAFFINITY_NP
+  }
+#endif // __linux
+
+  free(tdata);
+
+  return ((func)(data));
+}
+
+//
+// 'scale_icon()' - Scale a PNG icon to the specified size.
+//
+
+#ifdef HAVE_LIBPNG
+static unsigned char *			// O - PNG data or `NULL` on error
+scale_icon(
+    pappl_printer_t *printer,		// I - Printer
+    const void      *data,		// I - Source PNG data
+    size_t          datalen,		// I - Length of source PNG data
+    unsigned        size,		// I - Width and height of scaled icon
+    size_t          *pngdatalen)	// O - Length of scaled PNG data
+{
+  png_image		png;		// PNG image
+  unsigned char		*src = NULL,	// Source pixels
+			*dst = NULL,	// Scaled pixels
+			*dstptr,	// Pointer into scaled pixels
+			*pngdata = NULL;// Scaled PNG data
+  const unsigned char	*srcptr;	// Pointer into source pixels
+  png_alloc_size_t	pngsize = 0;	// Size of scaled PNG data
+  unsigned		x, y,		// Looping vars
+			sx, sy,		// Source looping vars
+			sx0, sx1,	// Source columns
+			sy0, sy1;	// Source rows
+  unsigned long		r, g, b, a,	// Accumulated color and alpha
+			count;		// Number of source pixels
+
+
+  *pngdatalen = 0;
+
+  // Load the source icon...
+  memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+
+  if (!png_image_begin_read_from_memory(&png, data, datalen))
+  {
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to read icon: %s", png.message);
+    return (NULL);
+  }
+
+  png.format = PNG_FORMAT_RGBA;
+
+  if ((src = malloc(PNG_IMAGE_SIZE(png))) == NULL || (dst = malloc(4 * size * size)) == NULL || !png_image_finish_read(&png, NULL, src, 0, NULL))
+  {
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to read icon: %s", png.message[0] ? png.message : strerror(errno));
+    goto done;
+  }
+
+  // Scale using the average of the source pixels under each scaled pixel,
+  // weighting colors by alpha so transparent pixels don't darken the edges...
+  for (y = 0, dstptr = dst; y < size; y ++)
+  {
+    sy0 = y * png.height / size;
+    if ((sy1 = (y + 1) * png.height / size) <= sy0)
+      sy1 = sy0 + 1;
+
+    for (x = 0; x < size; x ++, dstptr += 4)
+    {
+      sx0 = x * png.width / size;
+      if ((sx1 = (x + 1) * png.width / size) <= sx0)
+        sx1 = sx0 + 1;
+
+      for (r = g = b = a = count = 0, sy = sy0; sy < sy1; sy ++)
+      {
+        for (sx = sx0, srcptr = src + 4 * (sy * png.width + sx0); sx < sx1; sx ++, srcptr += 4, count ++)
+        {
+          r += (unsigned long)srcptr[0] * srcptr[3];
+          g += (unsigned long)srcptr[1] * srcptr[3];
+          b += (unsigned long)srcptr[2] * srcptr[3];
+          a += srcptr[3];
+        }
+      }
+
+      if (a)
+      {
+        dstptr[0] = (unsigned char)(r / a);
+        dstptr[1] = (unsigned char)(g / a);
+        dstptr[2] = (unsigned char)(b / a);
+      }
+      else
+      {
+        dstptr[0] = dstptr[1] = dstptr[2] = 0;
+      }
+
+      dstptr[3] = (unsigned char)(a / count);
+    }
+  }
+
+  // Write the scaled icon...
+  png_image_free(&png);
+
+  memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+  png.width   = size;
+  png.height  = size;
+  png.format  = PNG_FORMAT_RGBA;
+
+  if (!png_image_write_get_memory_size(png, pngsize, 0, dst, 0, NULL) || (pngdata = malloc(pngsize)) == NULL || !png_image_write_to_memory(&png, pngdata, &pngsize, 0, dst, 0, NULL))
+  {
+    papplLogPrinter(printer, PAPPL_LOGLEVEL_ERROR, "Unable to write %ux%u icon: %s", size, size, png.message[0] ? png.message : strerror(errno));
+    free(pngdata);
+    pngdata = NULL;
+    goto done;
+  }
+
+  papplLogPrinter(printer, PAPPL_LOGLEVEL_DEBUG, "Scaled %ux%u icon (%u bytes).", size, size, (unsigned)pngsize);
+
+  *pngdatalen = (size_t)pngsize;
+
+  done:
+
+  png_image_free(&png);
+  free(src);
+  free(dst);
+
+  return (pngdata);
+}
+#endif // HAVE_LIBPNG
+
+
 //
 // 'sighup_handler()' - SIGHUP handler
 //
@@ -16,10 +16,27 @@ extern "C" {
 #  endif // __cplusplus
 
 
+//
+// Limits...
+//
+
+#  define PAPPL_MAX_CPU		1024	// Maximum number of CPUs for thread affinity @since PAPPL 1.3@
+
+
 //
 // Types...
 //
 
+typedef enum pappl_memory_e		// Memory accounting subsystems @since PAPPL 1.3@
+{
+  PAPPL_MEMORY_JOBS,				// Jobs and job history
+  PAPPL_MEMORY_PRINTER_ATTRS,			// Printer and driver attributes
+  PAPPL_MEMORY_SUBSCRIPTIONS,			// Subscriptions and events
+  PAPPL_MEMORY_RESOURCES,			// Web resources
+  PAPPL_MEMORY_CLIENTS,				// Client connections and buffers
+  PAPPL_MEMORY_RIP				// Raster (RIP) buffers
+} pappl_memory_t;
+
 typedef struct pappl_pr_driver_s	// Printer driver information
 {
   const char	*name;				// Driver name
@@ -36,7 +53,7 @@ enum pappl_soptions_e			// System option bits
   PAPPL_SOPTIONS_RAW_SOCKET = 0x0004,		// Accept jobs via raw sockets
   PAPPL_SOPTIONS_USB_PRINTER = 0x0008,		// Accept jobs via USB for default printer (embedded Linux only)
   PAPPL_SOPTIONS_WEB_INTERFACE = 0x0010,	// Enable the standard web pages
-  PAPPL_SOPTIONS_WEB_LOG = 0x0020,		// Enable the log file page
+  PAPPL_SOPTIONS_WEB_LOG = 0x0020,		// Enable the log file and memory usage pages
   PAPPL_SOPTIONS_WEB_NETWORK = 0x0040,		// Enable the network settings page
   PAPPL_SOPTIONS_WEB_REMOTE = 0x0080,		// Allow remote queue management (vs. localhost only)
   PAPPL_SOPTIONS_WEB_SECURITY = 0x0100,		// Enable the user/password settings page
@@ -45,6 +62,23 @@ enum pappl_soptions_e			// System option bits
 };
 typedef unsigned pappl_soptions_t;	// Bitfield for system options
 
+typedef enum pappl_thread_e		// Thread classes @since PAPPL 1.3@
+{
+  PAPPL_THREAD_CLIENT,				// Client connection threads
+  PAPPL_THREAD_DEVICE,				// Device I/O threads (raw socket and USB gadget)
+  PAPPL_THREAD_JOB				// Job processing (RIP) and background task threads
+} pappl_thread_t;
+
+typedef struct pappl_thread_sched_s	// Thread scheduling parameters @since PAPPL 1.3@
+{
+  int			policy;			// `SCHED_xxx` scheduling policy or `0` for the default
+  int			priority;		// Priority for the `SCHED_FIFO` and `SCHED_RR` policies
+  int			nice;			// Nice value or `0` for the default (Linux only)
+  unsigned char		affinity[PAPPL_MAX_CPU / 8];
+						// CPU affinity bitmask (bit `N % 8` of byte `N / 8` for CPU `N`) or all zeros for any CPU (Linux only)
+  size_t		stack_size;		// Stack size in bytes or `0` for the default
+} pappl_thread_sched_t;
+
 typedef struct pappl_version_s		// Firmware version information
 {
   char			name[64];		// "xxx-firmware-name" value
@@ -140,8 +174,10 @@ extern int		papplSystemGetHostPort(pappl_system_t *system) _PAPPL_PUBLIC;
 extern char		*papplSystemGetLocation(pappl_system_t *system, char *buffer, size_t bufsize) _PAPPL_PUBLIC;
 extern pappl_loglevel_t	papplSystemGetLogLevel(pappl_system_t *system) _PAPPL_PUBLIC;
 extern int		papplSystemGetMaxClients(pappl_system_t *system) _PAPPL_PUBLIC;
+extern size_t		papplSystemGetMaxFormSize(pappl_system_t *system) _PAPPL_PUBLIC;
 extern size_t		papplSystemGetMaxLogSize(pappl_system_t *system) _PAPPL_PUBLIC;
 extern size_t		papplSystemGetMaxSubscriptions(pappl_system_t *system) _PAPPL_PUBLIC;
+extern bool		papplSystemGetMemoryUsage(pappl_system_t *system, pappl_memory_t subsystem, size_t *current, size_t *peak) _PAPPL_PUBLIC;
 extern char		*papplSystemGetName(pappl_system_t *system, char *buffer, size_t bufsize) _PAPPL_PUBLIC;
 extern int		papplSystemGetNextPrinterID(pappl_system_t *system) _PAPPL_PUBLIC;
 extern pappl_soptions_t	papplSystemGetOptions(pappl_system_t *system) _PAPPL_PUBLIC;
@@ -152,6 +188,7 @@ extern int		papplSystemGetPort(pappl_system_t *system) _PAPPL_DEPRECATED("Use pa
 extern const char	*papplSystemGetServerHeader(pappl_system_t *system) _PAPPL_PUBLIC;
 extern char		*papplSystemGetSessionKey(pappl_system_t *system, char *buffer, size_t bufsize) _PAPPL_PUBLIC;
 extern bool		papplSystemGetTLSOnly(pappl_system_t *system) _PAPPL_PUBLIC;
+extern bool		papplSystemGetThreadScheduling(pappl_system_t *system, pappl_thread_t thread, pappl_thread_sched_t *sched) _PAPPL_PUBLIC;
 extern const char	*papplSystemGetUUID(pappl_system_t *system) _PAPPL_PUBLIC;
 extern int		papplSystemGetVersions(pappl_system_t *system, int max_versions, pappl_version_t *versions) _PAPPL_PUBLIC;
 extern char		*papplSystemHashPassword(pappl_system_t *system, const char *salt, const char *password, char *buffer, size_t bufsize) _PAPPL_PUBLIC;
@@ -163,6 +200,7 @@ extern const char	*papplSystemMatchDriver(pappl_system_t *system, const char *de
 extern void		papplSystemRemoveLink(pappl_system_t *system, const char *label) _PAPPL_PUBLIC;
 extern void		papplSystemRemoveResource(pappl_system_t *system, const char *path) _PAPPL_PUBLIC;
 extern void		papplSystemRemoveTimerCallback(pappl_system_t *system, pappl_timer_cb_t cb, void *cb_data) _PAPPL_PUBLIC;
+extern void		papplSystemRetryDevices(pappl_system_t *system, const char *device_uri) _PAPPL_PUBLIC;
 extern void		papplSystemRun(pappl_system_t *system) _PAPPL_PUBLIC;
 extern bool		papplSystemSaveState(pappl_system_t *system, const char *filename) _PAPPL_PUBLIC;
 
@@ -180,6 +218,7 @@ extern void		papplSystemSetHostName(pappl_system_t *system, const char *value) _
 extern void		papplSystemSetLocation(pappl_system_t *system, const char *value) _PAPPL_PUBLIC;
 extern void		papplSystemSetLogLevel(pappl_system_t *system, pappl_loglevel_t loglevel) _PAPPL_PUBLIC;
 extern void		papplSystemSetMaxClients(pappl_system_t *system, int max_clients) _PAPPL_PUBLIC;
+extern void		papplSystemSetMaxFormSize(pappl_system_t *system, size_t max_size) _PAPPL_PUBLIC;
 extern void		papplSystemSetMaxLogSize(pappl_system_t *system, size_t max_size) _PAPPL_PUBLIC;
 extern void		papplSystemSetMaxSubscriptions(pappl_system_t *system, size_t max_subscriptions) _PAPPL_PUBLIC;
 extern void		papplSystemSetMIMECallback(pappl_system_t *system, pappl_mime_cb_t cb, void *data) _PAPPL_PUBLIC;
@@ -190,10 +229,13 @@ extern void		papplSystemSetOrganizationalUnit(pappl_system_t *system, const char
 extern void		papplSystemSetPassword(pappl_system_t *system, const char *hash) _PAPPL_PUBLIC;
 extern void		papplSystemSetPrinterDrivers(pappl_system_t *system, int num_drivers, pappl_pr_driver_t *drivers, pappl_pr_autoadd_cb_t autoadd_cb, pappl_pr_create_cb_t create_cb, pappl_pr_driver_cb_t driver_cb, void *data) _PAPPL_PUBLIC;
 extern void		papplSystemSetSaveCallback(pappl_system_t *system, pappl_save_cb_t cb, void *data) _PAPPL_PUBLIC;
+extern void		papplSystemSetThreadScheduling(pappl_system_t *system, pappl_thread_t thread, const pappl_thread_sched_t *sched) _PAPPL_PUBLIC;
 extern void		papplSystemSetUUID(pappl_system_t *system, const char *value) _PAPPL_PUBLIC;
 extern void		papplSystemSetVersions(pappl_system_t *system, int num_versions, pappl_version_t *versions) _PAPPL_PUBLIC;
 extern void		papplSystemSetWiFiCallbacks(pappl_system_t *system, pappl_wifi_join_cb_t join_cb, pappl_wifi_list_cb_t list_cb, pappl_wifi_status_cb_t status_cb, void *data) _PAPPL_PUBLIC;
+extern void		papplSystemSetWiFiStatus(pappl_system_t *system, const pappl_wifi_t *wifi) _PAPPL_PUBLIC;
 extern void		papplSystemShutdown(pappl_system_t *system) _PAPPL_PUBLIC;
+extern bool		papplSystemWaitRunning(pappl_system_t *system, bool running, int msecs) _PAPPL_PUBLIC;
 
 
 #  ifdef __cplusplus
@@ -111,6 +111,7 @@ static inline char *win32_realpath(const char *relpath, char *abspath)
 
 #define _PAPPL_MAX_TIMER_COUNT	32
 #define _PAPPL_TIMER_INTERVAL	5
+#define _PAPPL_TEST_BOUNDARY	"TestBoundary-8f0c47d2"
 
 
 //
@@ -153,15 +154,18 @@ static bool	device_list_cb(const char *device_info, const char *device_uri, cons
 static int	do_ps_query(const char *device_uri);
 static void	event_cb(pappl_system_t *system, pappl_printer_t *printer, pappl_job_t *job, pappl_event_t event, void *data);
 static const char *make_raster_file(ipp_t *response, bool grayscale, char *tempname, size_t tempsize);
+static bool	post_multipart_form(http_t *http, size_t offset, bool truncate, char *expected, size_t expsize, char *response, size_t respsize);
 static void	*run_tests(_pappl_testdata_t *testdata);
 static bool	test_api(pappl_system_t *system);
 static bool	test_api_printer(pappl_printer_t *printer);
 static bool	test_api_printer_cb(pappl_printer_t *printer, _pappl_testprinter_t *tp);
 static bool	test_client(pappl_system_t *system);
+static bool	test_form_cb(pappl_client_t *client, void *data);
 #if defined(HAVE_LIBJPEG) || defined(HAVE_LIBPNG)
 static bool	test_image_files(pappl_system_t *system, const char *prompt, const char *format, int num_files, const char * const *files);
 #endif // HAVE_LIBJPEG || HAVE_LIBPNG
 static bool	test_pwg_raster(pappl_system_t *system);
+static bool	test_requested_attributes(http_t *http, ipp_op_t op, int job_id, size_t num_names, const char * const *names);
 static bool	test_wifi_join_cb(pappl_system_t *system, void *data, const char *ssid, const char *psk);
 static int	test_wifi_list_cb(pappl_system_t *system, void *data, cups_dest_t **ssids);
 static pappl_wifi_t *test_wifi_status_cb(pappl_system_t *system, void *data, pappl_wifi_t *wifi_data);
@@ -627,6 +631,7 @@ main(int  argc,				// I - Number of command-line arguments
   papplSystemSetPrinterDrivers(system, (int)(sizeof(pwg_drivers) / sizeof(pwg_drivers[0])), pwg_drivers, pwg_autoadd, /* create_cb */NULL, pwg_callback, "testpappl");
   papplSystemSetWiFiCallbacks(system, test_wifi_join_cb, test_wifi_list_cb, test_wifi_status_cb, (void *)"testpappl");
   papplSystemAddLink(system, "Configuration", "/config", true);
+  papplSystemAddResourceCallback(system, "/test-form", "text/plain", test_form_cb, NULL);
   papplSystemSetFooterHTML(system,
                            "Copyright &copy; 2020-2022 by Michael R Sweet. "
                            "Provided under the terms of the <a href=\"https://www.apache.org/licenses/LICENSE-2.0\">Apache License 2.0</a>.");
@@ -721,13 +726,11 @@ main(int  argc,				// I - Number of command-line arguments
     return (1);
   }
 
-  while (!papplSystemIsRunning(system))
-    sleep(1);
+  papplSystemWaitRunning(system, true, 0);
 
   _papplSystemStatusUI(system);
 
-  while (papplSystemIsRunning(system))
-    sleep(1);
+  papplSystemWaitRunning(system, false, 0);
 
 #else
   // All other platforms run the system on the main thread...
@@ -1144,6 +1147,116 @@ make_raster_file(ipp_t      *response,  // I - Printer attributes
 }
 
 
+//
+// 'post_multipart_form()' - POST multipart form data to the "/test-form"
+//                           resource.
+//
+// The form contains a "title" variable and a "file" variable whose data
+// repeatedly includes partial boundary strings and ends at byte "offset" of the
+// request body, where the next boundary string starts.  When "truncate" is
+// `true`, the final boundary string is omitted.  The "expected" buffer receives
+// the response from "test_form_cb" for a successfully parsed form.
+//
+
+static bool				// O - `true` on success, `false` on error
+post_multipart_form(
+    http_t     *http,			// I - HTTP connection
+    size_t     offset,			// I - Offset of the boundary after the file data
+    bool       truncate,		// I - Omit the final boundary?
+    char       *expected,		// I - Expected response buffer
+    size_t     expsize,			// I - Size of expected response buffer
+    char       *response,		// I - Response buffer
+    size_t     respsize)		// I - Size of response buffer
+{
+  char		*body,			// Request body
+		*bodyptr,		// Pointer into body
+		*respptr,		// Pointer into response
+		*respend;		// End of response
+  size_t	i,			// Looping var
+		bodylen,		// Length of body
+		filesize,		// Size of file data
+		patlen;			// Length of data pattern
+  unsigned	checksum = 0;		// Checksum of file data
+  ssize_t	bytes;			// Bytes written/read
+  http_status_t	status;			// HTTP status
+  static const char * const pattern = "\r\n--" _PAPPL_TEST_BOUNDARY;
+					// Data pattern
+
+
+  *expected = '\0';
+  *response = '\0';
+
+  // Build the request body...
+  if ((body = malloc(offset + 1024)) == NULL)
+    return (false);
+
+  snprintf(body, 1024, "--" _PAPPL_TEST_BOUNDARY "\r\nContent-Disposition: form-data; name=\"title\"\r\n\r\nMultipart Test\r\n--" _PAPPL_TEST_BOUNDARY "\r\nContent-Disposition: form-data; name=\"file\"; filename=\"test.dat\"\r\nContent-Type: application/octet-stream\r\n\r\n");
+  bodyptr = body + strlen(body);
+
+  if (offset < (size_t)(bodyptr - body))
+  {
+    free(body);
+    return (false);
+  }
+
+  for (i = 0, filesize = offset - (size_t)(bodyptr - body), patlen = strlen(pattern) - 1; i < filesize; i ++)
+  {
+    *bodyptr++ = pattern[i % patlen];
+    checksum   = 31 * checksum + (unsigned char)pattern[i % patlen];
+  }
+
+  snprintf(expected, expsize, "2 Multipart Test %ld %08x\n", (long)filesize, checksum);
+
+  if (!truncate)
+  {
+    snprintf(bodyptr, 1024, "\r\n--" _PAPPL_TEST_BOUNDARY "--\r\n");
+    bodyptr += strlen(bodyptr);
+  }
+
+  bodylen = (size_t)(bodyptr - body);
+
+  // Send the POST request...
+  httpClearFields(http);
+  httpSetField(http, HTTP_FIELD_CONTENT_TYPE, "multipart/form-data; boundary=" _PAPPL_TEST_BOUNDARY);
+  httpSetLength(http, bodylen);
+
+#if CUPS_VERSION_MAJOR < 3
+  if (httpPost(http, "/test-form"))
+#else
+  if (!httpWriteRequest(http, "POST", "/test-form"))
+#endif // CUPS_VERSION_MAJOR < 3
+  {
+    free(body);
+    return (false);
+  }
+
+  for (bodyptr = body; bodyptr < (body + bodylen); bodyptr += bytes)
+  {
+    if ((bytes = httpWrite(http, bodyptr, (size_t)(body + bodylen - bodyptr) > 4096 ? 4096 : (size_t)(body + bodylen - bodyptr))) <= 0)
+      break;
+  }
+
+  free(body);
+
+  // Get the response...
+  while ((status = httpUpdate(http)) == HTTP_STATUS_CONTINUE);
+
+  if (status != HTTP_STATUS_OK)
+  {
+    httpFlush(http);
+    return (false);
+  }
+
+  for (respptr = response, respend = response + respsize - 1; respptr < respend && (bytes = httpRead(http, respptr, (size_t)(respend - respptr))) > 0; respptr += bytes);
+
+  *respptr = '\0';
+
+  httpFlush(http);
+
+  return (true);
+}
+
+
 //
 // 'run_tests()' - Run named tests.
 //
@@ -1184,8 +1297,7 @@ run_tests(_pappl_testdata_t *testdata)	// I - Testing data
   if (testdata->waitsystem)
   {
     // Wait for the system to start...
-    while (!papplSystemIsRunning(testdata->system))
-      sleep(1);
+    papplSystemWaitRunning(testdata->system, true, 0);
   }
 
   // Run each test...
@@ -2406,6 +2518,26 @@ test_api_printer(
   else
     testEnd(true);
 
+  // papplPrinterGetDriverAttributeString
+  testBegin("api: papplPrinterGetDriverAttributeString");
+  if (!papplPrinterGetDriverAttributeString(printer, "media-supported", get_str, sizeof(get_str), NULL))
+  {
+    testEndMessage(false, "got NULL, expected 'media-supported' value");
+    pass = false;
+  }
+  else if (!get_str[0])
+  {
+    testEndMessage(false, "got empty string, expected 'media-supported' value");
+    pass = false;
+  }
+  else if (papplPrinterGetDriverAttributeString(printer, "bogus-attribute", get_str, sizeof(get_str), NULL))
+  {
+    testEndMessage(false, "got '%s', expected NULL", get_str);
+    pass = false;
+  }
+  else
+    testEnd(true);
+
   // papplPrinterGet/SetGeoLocation
   testBegin("api: papplPrinterGetGeoLocation");
   if (!papplPrinterGetGeoLocation(printer, get_str, sizeof(get_str)))
@@ -2653,7 +2785,10 @@ test_client(pappl_system_t *system)	// I - System
   bool		ret = false;		// Return value
   http_t	*http;			// HTTP connection
   char		uri[1024],		// "printer-uri" value
-		filename[1024] = "";	// Print file
+		filename[1024] = "",	// Print file
+		formexpected[1024],	// Expected form response
+		formresponse[1024];	// Form response
+  size_t	max_form_size;		// Maximum form data size
   ipp_t		*request,		// Request
 		*response,		// Response
 		*supported = NULL;	// Supported values
@@ -2664,6 +2799,16 @@ test_client(pappl_system_t *system)	// I - System
 		job_id,			// "job-id" value
 		subscription_id;	// "notify-subscription-id" value
   time_t	end;			// End time
+  static const int offsets[] =		// Offsets of the file's boundary string
+  {
+    32768 - 12,
+    65536 - 24,
+    65536 - 12,
+    65536 - 1,
+    65536,
+    65536 + 1,
+    131072 - 12
+  };
   static const char * const events[] =	// "notify-events" attribute
   {
     "job-completed",
@@ -2687,6 +2832,33 @@ test_client(pappl_system_t *system)	// I - System
     "printer-uuid",
     "printer-uri-supported"
   };
+  static const char * const pfilter[] =	// Filtered printer attributes
+  {
+    "document-format-supported",
+    "ipp-versions-supported",
+    "media-supported",
+    "operations-supported",
+    "printer-name",
+    "printer-uuid"
+  };
+  static const char * const jfilter[] =	// Filtered job attributes
+  {
+    "job-id",
+    "job-name",
+    "job-originating-user-name",
+    "job-printer-uri",
+    "job-uri",
+    "job-uuid"
+  };
+  static const char * const sfilter[] =	// Filtered system attributes
+  {
+    "ipp-versions-supported",
+    "notify-events-supported",
+    "notify-lease-duration-supported",
+    "operations-supported",
+    "system-name",
+    "system-uuid"
+  };
   static const char * const sattrs[] =	// System attributes
   {
     "system-contact-col",
@@ -2713,6 +2885,69 @@ test_client(pappl_system_t *system)	// I - System
     testEnd(true);
   }
 
+  // Test multipart form data with the boundary string split across reads...
+  for (i = 0; i < (int)(sizeof(offsets) / sizeof(offsets[0])); i ++)
+  {
+    testBegin("client: Multipart form data (boundary at %d)", offsets[i]);
+
+    if (!post_multipart_form(http, (size_t)offsets[i], false, formexpected, sizeof(formexpected), formresponse, sizeof(formresponse)))
+    {
+      testEndMessage(false, "%s", cupsLastErrorString());
+      goto done;
+    }
+    else if (strcmp(formresponse, formexpected))
+    {
+      testEndMessage(false, "got '%s', expected '%s'", formresponse, formexpected);
+      goto done;
+    }
+    else
+    {
+      testEnd(true);
+    }
+  }
+
+  // Test that truncated and oversize multipart form data is rejected...
+  testBegin("client: Multipart form data (truncated)");
+
+  if (!post_multipart_form(http, 65536, true, formexpected, sizeof(formexpected), formresponse, sizeof(formresponse)))
+  {
+    testEndMessage(false, "%s", cupsLastErrorString());
+    goto done;
+  }
+  else if (strcmp(formresponse, "0 - 0 00000000\n"))
+  {
+    testEndMessage(false, "got '%s', expected no form variables", formresponse);
+    goto done;
+  }
+  else
+  {
+    testEnd(true);
+  }
+
+  testBegin("client: Multipart form data (too large)");
+
+  max_form_size = papplSystemGetMaxFormSize(system);
+  papplSystemSetMaxFormSize(system, 32768);
+
+  if (!post_multipart_form(http, 65536, false, formexpected, sizeof(formexpected), formresponse, sizeof(formresponse)))
+  {
+    papplSystemSetMaxFormSize(system, max_form_size);
+    testEndMessage(false, "%s", cupsLastErrorString());
+    goto done;
+  }
+
+  papplSystemSetMaxFormSize(system, max_form_size);
+
+  if (strcmp(formresponse, "0 - 0 00000000\n"))
+  {
+    testEndMessage(false, "got '%s', expected no form variables", formresponse);
+    goto done;
+  }
+  else
+  {
+    testEnd(true);
+  }
+
   // Test Get-System-Attributes
   testBegin("client: Get-System-Attributes");
 
@@ -2919,6 +3154,22 @@ test_client(pappl_system_t *system)	// I - System
 
   testEndMessage(true, "job-id=%d", job_id);
 
+  // Test that requested-attributes only returns the requested attributes...
+  testBegin("client: Get-System-Attributes (requested-attributes)");
+  if (!test_requested_attributes(http, IPP_OP_GET_SYSTEM_ATTRIBUTES, 0, sizeof(sfilter) / sizeof(sfilter[0]), sfilter))
+    goto done;
+  testEnd(true);
+
+  testBegin("client: Get-Printer-Attributes (requested-attributes)");
+  if (!test_requested_attributes(http, IPP_OP_GET_PRINTER_ATTRIBUTES, 0, sizeof(pfilter) / sizeof(pfilter[0]), pfilter))
+    goto done;
+  testEnd(true);
+
+  testBegin("client: Get-Job-Attributes (requested-attributes)");
+  if (!test_requested_attributes(http, IPP_OP_GET_JOB_ATTRIBUTES, job_id, sizeof(jfilter) / sizeof(jfilter[0]), jfilter))
+    goto done;
+  testEnd(true);
+
 #ifdef HAVE_LIBJPEG
   testBegin("client: Print-Job (JPEG)");
   request = ippNewRequest(IPP_OP_PRINT_JOB);
@@ -3079,6 +3330,61 @@ test_client(pappl_system_t *system)	// I - System
 }
 
 
+//
+// 'test_form_cb()' - Report the multipart form data sent to "/test-form".
+//
+// The response is a line containing the number of form variables, the
+// "title" value, the size of the "file" data, and a checksum of the data.
+//
+
+static bool				// O - `true` to keep the connection open
+test_form_cb(pappl_client_t *client,	// I - Client
+             void           *data)	// I - Callback data (unused)
+{
+  cups_len_t	num_form;		// Number of form variables
+  cups_option_t	*form;			// Form variables
+  const char	*title,			// "title" value
+		*filename;		// "file" value
+  cups_file_t	*fp;			// File
+  unsigned char	buffer[8192];		// Read buffer
+  ssize_t	i,			// Looping var
+		bytes;			// Bytes read
+  long		filesize = 0;		// Size of file data
+  unsigned	checksum = 0;		// Checksum of file data
+  char		response[1024];		// Response string
+
+
+  (void)data;
+
+  num_form = (cups_len_t)papplClientGetForm(client, &form);
+  title    = cupsGetOption("title", num_form, form);
+
+  if ((filename = cupsGetOption("file", num_form, form)) != NULL && (fp = cupsFileOpen(filename, "r")) != NULL)
+  {
+    while ((bytes = cupsFileRead(fp, (char *)buffer, sizeof(buffer))) > 0)
+    {
+      for (i = 0; i < bytes; i ++)
+        checksum = 31 * checksum + buffer[i];
+
+      filesize += (long)bytes;
+    }
+
+    cupsFileClose(fp);
+  }
+
+  snprintf(response, sizeof(response), "%d %s %ld %08x\n", (int)num_form, title ? title : "-", filesize, checksum);
+
+  cupsFreeOptions(num_form, form);
+
+  if (!papplClientRespond(client, HTTP_STATUS_OK, NULL, "text/plain", 0, strlen(response)))
+    return (false);
+
+  papplClientHTMLPuts(client, response);
+
+  return (true);
+}
+
+
 #if defined(HAVE_LIBJPEG) || defined(HAVE_LIBPNG)
 //
 // 'test_image_files()' - Run image file tests.
@@ -3365,6 +3671,116 @@ test_pwg_raster(pappl_system_t *system)	// I - System
 }
 
 
+//
+// 'test_requested_attributes()' - Test a Get-*-Attributes request with
+//                                 "requested-attributes".
+//
+// The filtered response must contain the requested attributes and nothing
+// else (other than operation attributes), with the same values as the
+// unfiltered response.
+//
+
+static bool				// O - `true` on success, `false` on failure
+test_requested_attributes(
+    http_t             *http,		// I - HTTP connection
+    ipp_op_t           op,		// I - Operation
+    int                job_id,		// I - "job-id" value or `0` for none
+    size_t             num_names,	// I - Number of requested attributes
+    const char * const *names)		// I - Requested attributes
+{
+  bool		ret = false;		// Return value
+  int		pass;			// Current pass
+  size_t	i;			// Looping var
+  ipp_t		*request,		// IPP request
+		*responses[2] = { NULL, NULL };
+					// Unfiltered and filtered responses
+  ipp_attribute_t *attr,		// Filtered attribute
+		*fullattr;		// Unfiltered attribute
+  const char	*name,			// Attribute name
+		*resource;		// Resource path
+  char		value[8192],		// Filtered value
+		fullvalue[8192];	// Unfiltered value
+
+
+  resource = op == IPP_OP_GET_SYSTEM_ATTRIBUTES ? "/ipp/system" : "/ipp/print";
+
+  for (pass = 0; pass < 2; pass ++)
+  {
+    request = ippNewRequest(op);
+    if (op == IPP_OP_GET_SYSTEM_ATTRIBUTES)
+      ippAddString(request, IPP_TAG_OPERATION, IPP_CONST_TAG(IPP_TAG_URI), "system-uri", NULL, "ipp://localhost/ipp/system");
+    else
+      ippAddString(request, IPP_TAG_OPERATION, IPP_CONST_TAG(IPP_TAG_URI), "printer-uri", NULL, "ipp://localhost/ipp/print");
+    if (job_id > 0)
+      ippAddInteger(request, IPP_TAG_OPERATION, IPP_TAG_INTEGER, "job-id", job_id);
+    ippAddString(request, IPP_TAG_OPERATION, IPP_TAG_NAME, "requesting-user-name", NULL, cupsGetUser());
+    if (pass)
+      ippAddStrings(request, IPP_TAG_OPERATION, IPP_CONST_TAG(IPP_TAG_KEYWORD), "requested-attributes", IPP_NUM_CAST num_names, NULL, names);
+
+    responses[pass] = cupsDoRequest(http, request, resource);
+
+    if (cupsLastError() != IPP_STATUS_OK)
+    {
+      testEndMessage(false, "%s", cupsLastErrorString());
+      goto done;
+    }
+  }
+
+  // Make sure the filtered response only has requested attributes...
+  for (attr = ippGetFirstAttribute(responses[1]); attr; attr = ippGetNextAttribute(responses[1]))
+  {
+    if ((name = ippGetName(attr)) == NULL || ippGetGroupTag(attr) == IPP_TAG_OPERATION)
+      continue;
+
+    for (i = 0; i < num_names; i ++)
+    {
+      if (!strcmp(name, names[i]))
+        break;
+    }
+
+    if (i >= num_names)
+    {
+      testEndMessage(false, "Unexpected '%s' attribute in response", name);
+      goto done;
+    }
+  }
+
+  // Then compare the values with the unfiltered response...
+  for (i = 0; i < num_names; i ++)
+  {
+    if ((attr = ippFindAttribute(responses[1], names[i], IPP_TAG_ZERO)) == NULL)
+    {
+      testEndMessage(false, "Missing requested '%s' attribute in response", names[i]);
+      goto done;
+    }
+
+    if ((fullattr = ippFindAttribute(responses[0], names[i], IPP_TAG_ZERO)) == NULL)
+    {
+      testEndMessage(false, "Missing '%s' attribute in unfiltered response", names[i]);
+      goto done;
+    }
+
+    ippAttributeString(attr, value, sizeof(value));
+    ippAttributeString(fullattr, fullvalue, sizeof(fullvalue));
+
+    if (ippGetGroupTag(attr) != ippGetGroupTag(fullattr) || ippGetValueTag(attr) != ippGetValueTag(fullattr) || strcmp(value, fullvalue))
+    {
+      testEndMessage(false, "Got %s %s '%s' for '%s', expected %s %s '%s'", ippTagString(ippGetGroupTag(attr)), ippTagString(ippGetValueTag(attr)), value, names[i], ippTagString(ippGetGroupTag(fullattr)), ippTagString(ippGetValueTag(fullattr)), fullvalue);
+      goto done;
+    }
+  }
+
+  ret = true;
+
+  done:
+
+  ippDelete(responses[0]);
+  ippDelete(responses[1]);
+
+  return (ret);
+}
+
+
 //
 // 'test_wifi_join_cb()' - Try joining a Wi-Fi network.
 //
@@ -153,10 +153,25 @@ typedef unsigned long useconds_t;
 /* #undef HAVE_PAM_PAM_APPL_H */
 
 
+// Entity tag support in libcups
+/* #undef HAVE_HTTP_FIELD_ETAG */
+
+
 // String functions
 /* #undef HAVE_STRLCPY */
 
 
+// File copy functions
+/* #undef HAVE_LINUX_FS_H */
+/* #undef HAVE_FICLONE */
+/* #undef HAVE_COPY_FILE_RANGE */
+/* #undef _GNU_SOURCE */
+
+
+// Thread CPU affinity
+/* #undef HAVE_PTHREAD_SETAFFINITY_NP */
+
+
 // Random number support
 /* #undef HAVE_SYS_RANDOM_H */
 /* #undef HAVE_ARC4RANDOM */
@@ -54,10 +54,25 @@
 /* #undef HAVE_PAM_PAM_APPL_H */
 
 
+// Entity tag support in libcups
+/* #undef HAVE_HTTP_FIELD_ETAG */
+
+
 // String functions
 #define HAVE_STRLCPY 1
 
 
+// File copy functions
+/* #undef HAVE_LINUX_FS_H */
+/* #undef HAVE_FICLONE */
+/* #undef HAVE_COPY_FILE_RANGE */
+/* #undef _GNU_SOURCE */
+
+
+// Thread CPU affinity
+/* #undef HAVE_PTHREAD_SETAFFINITY_NP */
+
+
 // Random number support
 #define HAVE_SYS_RANDOM_H 1
 #define HAVE_ARC4RANDOM 1